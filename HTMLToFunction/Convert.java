@@ -6,9 +6,17 @@ import java.nio.file.Files;
 import java.nio.file.Paths;
 import java.time.LocalDateTime;
 import java.time.format.DateTimeFormatter;
+import java.util.zip.CRC32;
+import java.util.zip.Deflater;
 
 public class Convert {
 
+    // gzip member header: deflate, no flags, no mtime (so the output only
+    // changes when the page does), max compression, unknown OS
+    private static final byte[] GZIP_HEADER = {
+        0x1f, (byte) 0x8b, 8, 0, 0, 0, 0, 0, 2, (byte) 0xff
+    };
+
     private static String escapeLine(String line) {
         // Escape backslashes and double quotes; drop '\r' if present
         StringBuilder sb = new StringBuilder(line.length() * 2 + 16);
@@ -24,20 +32,85 @@ public class Convert {
         return sb.toString();
     }
 
-    public static void main(String[] args) {
-        if (args.length < 1 || args.length > 2) {
-            System.err.println("Usage: java Convert <input.html> [output.txt]");
-            System.exit(1);
+    // The page exactly as createHTML() used to build it: every line ends in '\n'
+    private static byte[] readPage(String inPath) throws IOException {
+        StringBuilder page = new StringBuilder();
+        try (BufferedReader br = Files.newBufferedReader(Paths.get(inPath), StandardCharsets.UTF_8)) {
+            String line;
+            while ((line = br.readLine()) != null) {
+                page.append(line.replace("\r", "")).append('\n');
+            }
         }
+        return page.toString().getBytes(StandardCharsets.UTF_8);
+    }
 
+    private static void writeLE32(ByteArrayOutputStream out, long v) {
+        for (int i = 0; i < 4; i++) out.write((int) (v >> (8 * i)) & 0xff);
+    }
 
-        String inPath = args[0];
-        String outPath = (args.length == 2) ? args[1] : "./createHTML.txt";
+    // gzip written by hand rather than with GZIPOutputStream, whose header
+    // bytes and level differ between JDKs; this is the same on every machine
+    private static byte[] gzip(byte[] data) {
+        Deflater deflater = new Deflater(Deflater.BEST_COMPRESSION, true);
+        deflater.setInput(data);
+        deflater.finish();
+        ByteArrayOutputStream out = new ByteArrayOutputStream(data.length / 3 + 64);
+        out.write(GZIP_HEADER, 0, GZIP_HEADER.length);
+        byte[] buf = new byte[4096];
+        while (!deflater.finished()) {
+            int n = deflater.deflate(buf);
+            out.write(buf, 0, n);
+        }
+        deflater.end();
+        CRC32 crc = new CRC32();
+        crc.update(data);
+        writeLE32(out, crc.getValue());
+        writeLE32(out, data.length);
+        return out.toByteArray();
+    }
 
-        // Get timestamp
-        DateTimeFormatter fmt = DateTimeFormatter.ofPattern("yyyy-MM-dd HH:mm:ss");
-        String timestamp = LocalDateTime.now().format(fmt);
+    // 32-bit FNV-1a
+    private static int fnv1a(byte[] data) {
+        int h = 0x811c9dc5;
+        for (byte b : data) {
+            h ^= (b & 0xff);
+            h *= 0x01000193;
+        }
+        return h;
+    }
 
+    private static void writeGzipHeader(String inPath, String outPath, String timestamp) throws IOException {
+        byte[] page = readPage(inPath);
+        byte[] gz = gzip(page);
+        String name = Paths.get(inPath).getFileName().toString();
+
+        try (BufferedWriter bw = Files.newBufferedWriter(Paths.get(outPath), StandardCharsets.UTF_8)) {
+            bw.write("// Auto-generated by Convert on " + timestamp + " from " + name + "\n");
+            bw.write("// " + page.length + " bytes of HTML, gzip-compressed to " + gz.length + ". Send it as is\n");
+            bw.write("// with Content-Encoding: gzip. The hash is FNV-1a of the compressed bytes,\n");
+            bw.write("// and the ETag is the hash quoted, so it changes exactly when the page does.\n\n");
+            bw.write("#ifndef WEBPAGEHTML_H\n");
+            bw.write("#define WEBPAGEHTML_H\n\n");
+            bw.write("#include <Arduino.h>\n\n");
+            int hash = fnv1a(gz);
+            bw.write(String.format("#define webPage_gzHash     0x%08xUL\n", hash));
+            bw.write(String.format("#define webPage_gzETag     \"\\\"%08x\\\"\"\n", hash));
+            bw.write("#define webPage_gzLength   " + gz.length + "\n\n");
+            bw.write("const uint8_t webPage_gz[webPage_gzLength] PROGMEM = {\n");
+            for (int i = 0; i < gz.length; i += 16) {
+                bw.write("   ");
+                for (int j = i; j < Math.min(i + 16, gz.length); j++) {
+                    bw.write(String.format(" 0x%02x,", gz[j] & 0xff));
+                }
+                bw.write("\n");
+            }
+            bw.write("};\n\n");
+            bw.write("#endif\n");
+        }
+        System.out.println("Wrote " + gz.length + " byte gzip page (" + page.length + " bytes of HTML) to: " + outPath);
+    }
+
+    private static void writeStringFunction(String inPath, String outPath, String timestamp) throws IOException {
         try (BufferedReader br = Files.newBufferedReader(Paths.get(inPath), StandardCharsets.UTF_8);
              BufferedWriter bw = Files.newBufferedWriter(Paths.get(outPath), StandardCharsets.UTF_8)) {
 
@@ -63,8 +136,35 @@ public class Convert {
 
             bw.flush();
             System.out.println("Wrote Arduino String function to: " + outPath);
+        }
+    }
+
+    public static void main(String[] args) {
+        // Default: a gzip blob header for the sketch to serve from flash.
+        // --string: the old createHTML() that builds the page in a String.
+        boolean stringFunction = args.length > 0 && args[0].equals("--string");
+        int first = stringFunction ? 1 : 0;
+        int count = args.length - first;
+        if (count < 1 || count > 2) {
+            System.err.println("Usage: java Convert [--string] <input.html> [output]");
+            System.exit(1);
+        }
+
+        String inPath = args[first];
+        String outPath = (count == 2) ? args[first + 1]
+                                      : (stringFunction ? "./createHTML.txt" : "./WebPageHtml.h");
+
+        // Get timestamp
+        DateTimeFormatter fmt = DateTimeFormatter.ofPattern("yyyy-MM-dd HH:mm:ss");
+        String timestamp = LocalDateTime.now().format(fmt);
 
-        } catch (FileNotFoundException e) {
+        try {
+            if (stringFunction) {
+                writeStringFunction(inPath, outPath, timestamp);
+            } else {
+                writeGzipHeader(inPath, outPath, timestamp);
+            }
+        } catch (FileNotFoundException | java.nio.file.NoSuchFileException e) {
             System.err.println("Input file not found: " + inPath);
             System.exit(2);
         } catch (IOException e) {
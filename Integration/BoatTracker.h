@@ -0,0 +1,182 @@
+#pragma once
+#include <Arduino.h>
+#include "Config.h"
+#include "main.h"
+
+// Fuses SonarWait and SonarUnder into boat tracks.
+//
+// Geometry: SonarWait looks down the channel at approaching traffic, so its
+// distance is how far the nearest boat is from the waiting line. SonarUnder
+// looks across the channel beneath the span, so it only says "something is
+// under". The two are SONAR_SPACING_MM apart along the channel.
+//
+// A boat closing on SonarWait opens an inbound track (APPROACH), which becomes
+// WAITING inside BOAT_WAITING_MM and UNDER when SonarUnder fires. The gap
+// between those two triggers gives its transit speed. A boat that shows up
+// under the span with no inbound track is outbound (it came from the far
+// side) and is kept until it has passed SonarWait. A track nobody has seen
+// for a while (see timeoutMs()) is dropped, so it can't hold the bridge forever.
+
+enum BoatDir   : int8_t  { DIR_UNKNOWN = 0, DIR_INBOUND = 1, DIR_OUTBOUND = -1 };
+enum BoatPhase : uint8_t { TRK_APPROACH, TRK_WAITING, TRK_UNDER, TRK_LEAVING };
+
+struct BoatTrack {
+  bool      active   = false;
+  BoatDir   dir      = DIR_UNKNOWN;
+  BoatPhase phase    = TRK_APPROACH;
+  uint32_t  tOpen    = 0;       // ms the track was opened
+  uint32_t  tWait    = 0;       // ms it reached the waiting line (0 = not yet)
+  uint32_t  tUnder   = 0;       // ms SonarUnder first saw it (0 = not yet)
+  uint32_t  tSeen    = 0;       // ms either sensor last saw it
+  uint16_t  closeMMs = 0;       // closing speed on SonarWait, mm/s
+  uint16_t  speedMMs = 0;       // wait -> under transit speed, mm/s (0 = unknown)
+};
+
+class BoatTracker {
+public:
+  void update(const SensorFrame& f) {
+    const uint32_t t = f.tMs;
+    updateClosing(f);
+
+    BoatTrack* in = find(DIR_INBOUND, TRK_APPROACH, TRK_WAITING);
+
+    // Inbound: approaching, then at the waiting line
+    if (!in && !f.boatWaiting && _closeMMs >= BOAT_MIN_CLOSE_MMS) {
+      in = open(DIR_INBOUND, TRK_APPROACH, t);
+    }
+    if (f.boatWaiting) {
+      BoatTrack* out = find(DIR_OUTBOUND, TRK_LEAVING, TRK_LEAVING);
+      if (out) out->tSeen = t;                  // outbound boat passing the wait sensor
+      else if (in) {
+        if (in->phase == TRK_APPROACH) { in->phase = TRK_WAITING; in->tWait = t; }
+        in->tSeen = t;
+      } else if (!_prevWaiting) {
+        in = open(DIR_INBOUND, TRK_WAITING, t);     // arrived without being seen closing
+      }
+      // else: the tail of a long boat that is already under the span
+    } else if (in && in->phase == TRK_APPROACH && _closeMMs) {
+      in->tSeen = t;
+    }
+    if (in) in->closeMMs = _closeMMs;
+
+    // Under the span
+    if (f.boatUnder && !_prevUnder) {
+      if (in) {
+        in->phase = TRK_UNDER; in->tUnder = t;
+        if (in->tWait && t > in->tWait)
+          in->speedMMs = sat16(SONAR_SPACING_MM.mm() * 1000UL / (t - in->tWait));
+      } else {
+        BoatTrack* out = open(DIR_OUTBOUND, TRK_UNDER, t);
+        out->tUnder = t;
+      }
+    }
+    if (f.boatUnder) {
+      BoatTrack* u = find(DIR_UNKNOWN, TRK_UNDER, TRK_UNDER);
+      if (u) u->tSeen = t;
+    }
+    if (!f.boatUnder && _prevUnder) {
+      BoatTrack* u = find(DIR_UNKNOWN, TRK_UNDER, TRK_UNDER);
+      if (u) {
+        if (u->dir == DIR_INBOUND) u->active = false;     // through and clear of the span
+        else { u->phase = TRK_LEAVING; u->tSeen = t; }    // still has to pass SonarWait
+      }
+    }
+    if (!f.boatWaiting && _prevWaiting) {
+      BoatTrack* out = find(DIR_OUTBOUND, TRK_LEAVING, TRK_LEAVING);
+      if (out) out->active = false;
+    }
+    _prevUnder = f.boatUnder;
+    _prevWaiting = f.boatWaiting;
+
+    for (uint8_t i = 0; i < BOAT_MAX_TRACKS; i++) {
+      BoatTrack& k = _trk[i];
+      if (k.active && t - k.tSeen > timeoutMs(k)) k.active = false;
+    }
+  }
+
+  uint8_t count() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < BOAT_MAX_TRACKS; i++) if (_trk[i].active) n++;
+    return n;
+  }
+
+  // Time until the nearest approaching boat reaches the waiting line, or
+  // UINT32_MAX if none is approaching. 0 once one is waiting there; a boat
+  // already under the span (or past it) has no say.
+  uint32_t etaMs() const {
+    uint32_t best = UINT32_MAX;
+    for (uint8_t i = 0; i < BOAT_MAX_TRACKS; i++) {
+      const BoatTrack& k = _trk[i];
+      if (!k.active || k.dir != DIR_INBOUND) continue;
+      if (k.phase == TRK_WAITING) return 0;
+      if (k.phase != TRK_APPROACH || !k.closeMMs) continue;
+      uint32_t gap = _lastWait > BOAT_WAITING_MM ? _lastWait.mm() - BOAT_WAITING_MM.mm() : 0;
+      uint32_t eta = gap * 1000UL / k.closeMMs;
+      if (eta < best) best = eta;
+    }
+    return best;
+  }
+
+  const BoatTrack& track(uint8_t i) const { return _trk[i]; }
+
+private:
+  static uint16_t sat16(uint32_t v) { return v > 0xFFFF ? 0xFFFF : (uint16_t)v; }
+
+  // Closing speed on SonarWait from the trend of its filtered distance.
+  // Only confident, in-range readings count; anything else resets it.
+  void updateClosing(const SensorFrame& f) {
+    bool ok = f.waitValid && f.waitMM < BOAT_APPROACH_MM;
+    if (!ok) { _closeMMs = 0; _haveWait = false; return; }
+    if (_haveWait && f.tMs - _lastWaitT >= BOAT_CLOSE_SAMPLE_MS) {
+      uint32_t dt = f.tMs - _lastWaitT;
+      uint32_t v = _lastWait > f.waitMM ? (uint32_t)(_lastWait.mm() - f.waitMM.mm()) * 1000UL / dt : 0;
+      _closeMMs = sat16((_closeMMs + v) / 2);   // light smoothing
+      _lastWait = f.waitMM; _lastWaitT = f.tMs;
+    } else if (!_haveWait) {
+      _haveWait = true; _lastWait = f.waitMM; _lastWaitT = f.tMs;
+    }
+  }
+
+  // How long a track may go unseen: twice its expected sensor-to-sensor
+  // transit when the speed is known, otherwise the configured ceiling.
+  static uint32_t timeoutMs(const BoatTrack& k) {
+    if (k.speedMMs) {
+      uint32_t expect = SONAR_SPACING_MM.mm() * 2000UL / k.speedMMs;
+      if (expect < BOAT_TRACK_TIMEOUT_MS) return expect;
+    }
+    return BOAT_TRACK_TIMEOUT_MS;
+  }
+
+  BoatTrack* open(BoatDir dir, BoatPhase phase, uint32_t t) {
+    BoatTrack* slot = &_trk[0];
+    for (uint8_t i = 0; i < BOAT_MAX_TRACKS; i++) {
+      if (!_trk[i].active) { slot = &_trk[i]; break; }
+      if (_trk[i].tSeen < slot->tSeen) slot = &_trk[i];     // all full: reuse the stalest
+    }
+    *slot = BoatTrack();
+    slot->active = true; slot->dir = dir; slot->phase = phase;
+    slot->tOpen = slot->tSeen = t;
+    if (phase == TRK_WAITING) slot->tWait = t;
+    return slot;
+  }
+
+  // Oldest active track in [lo, hi]; DIR_UNKNOWN matches either direction.
+  BoatTrack* find(BoatDir dir, BoatPhase lo, BoatPhase hi) {
+    BoatTrack* best = nullptr;
+    for (uint8_t i = 0; i < BOAT_MAX_TRACKS; i++) {
+      BoatTrack& k = _trk[i];
+      if (!k.active || k.phase < lo || k.phase > hi) continue;
+      if (dir != DIR_UNKNOWN && k.dir != dir) continue;
+      if (!best || k.tOpen < best->tOpen) best = &k;
+    }
+    return best;
+  }
+
+  BoatTrack  _trk[BOAT_MAX_TRACKS];
+  DistanceMM _lastWait;
+  uint32_t   _lastWaitT = 0;
+  uint16_t   _closeMMs  = 0;
+  bool       _haveWait  = false;
+  bool       _prevUnder = false;
+  bool       _prevWaiting = false;
+};
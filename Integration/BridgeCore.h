@@ -0,0 +1,119 @@
+#pragma once
+#include "main.h"
+#include "Motor.h"
+#include "Fsm.h"
+
+// Finite State Machine based off Bridge State diagram!
+enum State : uint8_t { DOWN, PREP_RAISE, RAISING, UP, PREP_LOW, LOWERING, EMERG_RAISE, EMERG_LOWER };
+
+// What every handler gets for one tick
+struct TickCtx {
+  const SensorFrame& f;
+  bool reqRaise, reqLower, reqAbort;
+};
+
+// The bridge FSM over a hardware policy Hw (see Hardware.h). Every light,
+// gate and motor call is Hw::fn(), so one set of handlers builds against the
+// board and against the host simulation without any hooks to wire up.
+template <class Hw>
+class BridgeCore {
+public:
+  static void init(const MainConfig& cfg) { C=cfg; Hw::begin(); }
+  static State tick(TickCtx& c) { return Bridge.tick(c, c.f.tMs); }
+  static State state() { return Bridge.state(); }
+  static const Motor<Hw>& motor() { return Act; }
+
+private:
+  static MainConfig C;
+  static Motor<Hw>  Act;
+  // per-motion contexts
+  static bool raisingDecel, loweringDecel;
+
+  // ---------- State handlers (see Fsm.h) ----------
+  static void motionStop(TickCtx&) { Act.stop(); }
+
+  static void downEnter(TickCtx&) { Hw::roadGreen(); Hw::marineRed(); Hw::gatesUp(); Act.stop(); }
+  static State downTick(TickCtx& c, uint32_t) {
+    return (c.reqRaise || c.f.boatWaiting || c.f.boatApproaching) ? PREP_RAISE : DOWN;
+  }
+
+  static void prepRaiseEnter(TickCtx&) { Hw::roadYellow(); Hw::marineRed(); Hw::gatesDown(); }
+  static State prepRaiseTick(TickCtx& c, uint32_t el) {
+    if (c.f.carOn) return EMERG_LOWER;
+    if (el >= C.T_YELLOW && Hw::gatesAreDown()) return RAISING;
+    return PREP_RAISE;
+  }
+
+  static void raisingEnter(TickCtx&) {
+    raisingDecel=false; Hw::roadRed(); Hw::marineRed(); Hw::gatesDown();
+    Act.enable(); Act.dirUp(); Act.setSpeed(C.PWM_OPEN_CRUISE);
+  }
+  static State raisingTick(TickCtx& c, uint32_t el) {
+    if (c.f.estop || c.reqAbort || c.f.carOn) return EMERG_LOWER;
+
+    if (!raisingDecel && el >= C.T_OPEN_EXPECTED) { raisingDecel=true; Act.setSpeed(C.PWM_OPEN_SLOW); }
+    else { Act.setSpeed(raisingDecel ? C.PWM_OPEN_SLOW : C.PWM_OPEN_CRUISE); }
+
+    if (c.f.top)                 return UP;
+    if (el >= C.T_OPEN_MAX)      return EMERG_LOWER;
+    return RAISING;
+  }
+
+  static void upEnter(TickCtx&) { Hw::roadRed(); Hw::marineGreen(); Hw::gatesDown(); Act.stop(); }
+  static State upTick(TickCtx& c, uint32_t) {
+    // Lower as soon as the last tracked boat has cleared the span
+    if (c.reqLower || (!c.f.boatWaiting && !c.f.boatUnder && !c.f.boatsTracked)) return PREP_LOW;
+    return UP;
+  }
+
+  static void prepLowEnter(TickCtx&) { Hw::marineRed(); } // road remains red; gates remain down
+  static State prepLowTick(TickCtx& c, uint32_t) {
+    if (c.f.boatUnder || c.f.boatWaiting || c.f.boatsTracked) return UP;
+    return LOWERING; // "All clear"
+  }
+
+  static void loweringEnter(TickCtx&) {
+    loweringDecel=false; Hw::roadRed(); Hw::marineRed(); Hw::gatesDown();
+    Act.enable(); Act.dirDown(); Act.setSpeed(C.PWM_CLOSE_CRUISE);
+  }
+  static State loweringTick(TickCtx& c, uint32_t el) {
+    if (c.f.estop || c.reqAbort || c.f.boatUnder) return EMERG_RAISE;
+
+    if (!loweringDecel && el >= C.T_CLOSE_EXPECTED) { loweringDecel=true; Act.setSpeed(C.PWM_CLOSE_SLOW); }
+    else { Act.setSpeed(loweringDecel ? C.PWM_CLOSE_SLOW : C.PWM_CLOSE_CRUISE); }
+
+    if (c.f.bot)                 return DOWN;
+    if (el >= C.T_CLOSE_MAX)     return EMERG_RAISE;
+    return LOWERING;
+  }
+
+  static void emergRaiseEnter(TickCtx&) {
+    Hw::roadRed(); Hw::marineRed(); Hw::gatesDown(); Act.enable(); Act.dirUp(); Act.setSpeed(C.PWM_OPEN_CRUISE);
+  }
+  static State emergRaiseTick(TickCtx& c, uint32_t) { return c.f.top ? UP : EMERG_RAISE; }
+
+  static void emergLowerEnter(TickCtx&) {
+    Hw::roadRed(); Hw::marineRed(); Hw::gatesDown(); Act.enable(); Act.dirDown(); Act.setSpeed(C.PWM_CLOSE_CRUISE);
+  }
+  static State emergLowerTick(TickCtx& c, uint32_t) { return c.f.bot ? DOWN : EMERG_LOWER; }
+
+  // Every motion state stops the motor on its way out, whichever way it leaves.
+  static constexpr FsmRow<State, TickCtx> States[8] = {
+    { DOWN,        downEnter,       downTick,       nullptr    },
+    { PREP_RAISE,  prepRaiseEnter,  prepRaiseTick,  nullptr    },
+    { RAISING,     raisingEnter,    raisingTick,    motionStop },
+    { UP,          upEnter,         upTick,         nullptr    },
+    { PREP_LOW,    prepLowEnter,    prepLowTick,    nullptr    },
+    { LOWERING,    loweringEnter,   loweringTick,   motionStop },
+    { EMERG_RAISE, emergRaiseEnter, emergRaiseTick, motionStop },
+    { EMERG_LOWER, emergLowerEnter, emergLowerTick, motionStop },
+  };
+  static Fsm<State, TickCtx, 8, States> Bridge;
+};
+
+template <class Hw> MainConfig BridgeCore<Hw>::C;
+template <class Hw> Motor<Hw>  BridgeCore<Hw>::Act;
+template <class Hw> bool       BridgeCore<Hw>::raisingDecel = false;
+template <class Hw> bool       BridgeCore<Hw>::loweringDecel = false;
+template <class Hw> constexpr FsmRow<State, TickCtx> BridgeCore<Hw>::States[8];
+template <class Hw> Fsm<State, TickCtx, 8, BridgeCore<Hw>::States> BridgeCore<Hw>::Bridge(DOWN);
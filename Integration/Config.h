@@ -1,4 +1,6 @@
 // ALL TO BE CHANGED/TUNED
+#pragma once
+#include "Units.h"
 
 // Pins 
 #define PIN_MOTOR_PWM      27
@@ -10,6 +12,10 @@
 #define PIN_LIM_TOP        32
 #define PIN_LIM_BOT        25
 
+// Input edge layer (see InputEvents.h)
+#define INPUT_DEBOUNCE_US   5000UL // lockout after an accepted edge
+#define INPUT_QUEUE_LEN     32     // pending edges (power of two)
+
 // pins for ULTRASONIC
 #define PIN_TRIG_WAIT       4
 #define PIN_ECHO_WAIT       5
@@ -34,6 +40,25 @@
 #define DUTY_CLOSE_CRUISE   160
 #define DUTY_CLOSE_SLOW     100
 
-// Sensor thresholds 
-#define BOAT_WAITING_MM     400
-#define BOAT_UNDER_MM       300
+// Sensor thresholds (fixed-point mm, see Units.h)
+#define BOAT_WAITING_MM     400_mm
+#define BOAT_UNDER_MM       300_mm
+
+// Boat tracking (see BoatTracker.h)
+#define BOAT_APPROACH_MM    1500_mm  // SonarWait range at which a closing boat is tracked
+#define SONAR_SPACING_MM    600_mm   // SonarWait to SonarUnder, along the channel
+#define BOAT_MIN_CLOSE_MMS  20       // slower than this (mm/s) is drifting, not approaching
+#define BOAT_CLOSE_SAMPLE_MS 200UL   // spacing of the samples the closing speed is taken from
+#define BOAT_TRACK_TIMEOUT_MS 10000UL // drop a track nobody has seen for this long
+#define BOAT_MAX_TRACKS     4
+
+// Sonar filter stage (see DistanceFilter.h; the window is Sonic_FilterWindow
+// in SonicScheduler.h)
+#define SONAR_MIN_MM        20_mm  // HC-SR04 blind zone
+#define SONAR_MAX_MM        4000_mm
+#define SONAR_TOL_MM        50_mm  // echoes within this of the median "agree"
+#define SONAR_MIN_CONF      60     // % confidence needed before a reading counts
+
+// Web server (see HttpTask.h; it runs in its own task)
+#define WEB_PORT            80
+#define WEB_PUBLISH_MS      50UL   // latencies; a light change goes out at once
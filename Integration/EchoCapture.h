@@ -0,0 +1,45 @@
+#ifndef ECHOCAPTURE_H
+#define ECHOCAPTURE_H
+
+#include <Arduino.h>
+
+// Non-blocking HC-SR04 echo timing (based on testing/Double_Ultrasonic_V2).
+// trigger() fires the 10us pulse and returns; a CHANGE interrupt on the echo
+// pin timestamps both edges and publishes the finished width. Nothing in here
+// waits on acoustic flight time.
+
+#define ECHO_TIMEOUT_US 30000UL   // widths at/over this are "no echo" (0), like pulseIn()
+
+struct EchoSample {
+    uint32_t widthUs;   // echo high time, 0 = no echo
+    uint32_t stampUs;   // micros() at the falling edge
+    uint32_t count;     // number of echoes published so far
+};
+
+class EchoCapture {
+    private:
+        uint8_t trigPin;
+        uint8_t echoPin;
+        uint32_t timeoutUs;
+
+        volatile bool inFlight;
+        volatile uint32_t trigAt;
+        volatile uint32_t riseAt;
+
+        // Published by the ISR only. seq is odd while a write is in progress.
+        volatile uint32_t seq;
+        volatile uint32_t width;
+        volatile uint32_t stamp;
+        volatile uint32_t count;
+
+        static void echoISR(void* arg);
+    public:
+        EchoCapture(uint8_t trig, uint8_t echo, uint32_t timeout = ECHO_TIMEOUT_US);
+        void init();
+        bool trigger();
+        bool busy();
+        bool latest(EchoSample& out) const;
+        uint32_t widthUs() const;
+};
+
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+#include <Arduino.h>
+#include "Config.h"
+
+// Hardware policies for BridgeCore (see BridgeCore.h).
+//
+// A policy is a type with static functions for everything the FSM drives or
+// asks about the outside world. BridgeCore<Hw> and Motor<Hw> call them as
+// Hw::fn(), so the calls are resolved when the template is instantiated and
+// inline like any other function; there are no hook pointers to bind or
+// re-bind at run time.
+//
+//   begin()                               pin setup, once from Main_init
+//   motorEnable/Disable/DirUp/DirDown()   H-bridge control
+//   motorWritePWM(duty255)
+//   roadGreen/Yellow/Red(), marineGreen/Red()
+//   gatesUp/Down(), gatesAreDown()
+//   carOnBridge()
+
+// The board.
+struct Esp32Hw {
+  static void begin() {
+    pinMode(PIN_MOTOR_DIR, OUTPUT);
+    pinMode(PIN_MOTOR_PWM, OUTPUT);
+  }
+
+  static void motorEnable()  {/* EN pin high if you have one */}
+  static void motorDisable() {/* EN pin low  */}
+  static void motorDirUp()   { digitalWrite(PIN_MOTOR_DIR, HIGH); }
+  static void motorDirDown() { digitalWrite(PIN_MOTOR_DIR, LOW);  }
+  static void motorWritePWM(int duty255) { analogWrite(PIN_MOTOR_PWM, constrain(duty255, 0, 255)); }
+
+  // Lights / gates (stubs)
+  static void roadGreen()  {}
+  static void roadYellow() {}
+  static void roadRed()    {}
+  static void marineGreen(){}
+  static void marineRed()  {}
+  static void gatesUp()    {}
+  static void gatesDown()  {}
+  static bool gatesAreDown(){ return true; }
+
+  static bool carOnBridge() { /* pressure plates */ return false; }
+};
+
+// Host simulation. Outputs land in one struct a test or plant model can read,
+// and the inputs the board would sense are fields it can set.
+struct SimIo {
+  bool motorOn  = false;
+  bool dirUp    = false;
+  int  duty     = 0;
+  char road     = 'R';      // 'G', 'Y', 'R'
+  char marine   = 'R';      // 'G', 'R'
+  bool gatesDown = false;
+  bool gatesDownOk = true;  // what gatesAreDown() reports
+  bool carOn    = false;
+};
+
+struct SimHw {
+  static SimIo& io() { static SimIo s; return s; }
+
+  static void begin() { io() = SimIo(); }
+
+  static void motorEnable()  { io().motorOn = true; }
+  static void motorDisable() { io().motorOn = false; }
+  static void motorDirUp()   { io().dirUp = true; }
+  static void motorDirDown() { io().dirUp = false; }
+  static void motorWritePWM(int duty255) { io().duty = constrain(duty255, 0, 255); }
+
+  static void roadGreen()  { io().road = 'G'; }
+  static void roadYellow() { io().road = 'Y'; }
+  static void roadRed()    { io().road = 'R'; }
+  static void marineGreen(){ io().marine = 'G'; }
+  static void marineRed()  { io().marine = 'R'; }
+  static void gatesUp()    { io().gatesDown = false; }
+  static void gatesDown()  { io().gatesDown = true; }
+  static bool gatesAreDown(){ return io().gatesDown && io().gatesDownOk; }
+
+  static bool carOnBridge() { return io().carOn; }
+};
+
+// The policy this build drives
+#ifdef ESP32
+typedef Esp32Hw BridgeHw;
+#else
+typedef SimHw BridgeHw;
+#endif
@@ -0,0 +1,28 @@
+#include "HttpTask.h"
+
+const HttpRoute httpRoutes[] = {
+  { "/",           Http_Page,    Http_NoCommand },
+  { "/state",      Http_State,   Http_NoCommand },
+  { "/events",     Http_Events,  Http_NoCommand },
+  { "/switch1on",  Http_Command, Web_Switch1On },
+  { "/switch1off", Http_Command, Web_Switch1Off },
+  { "/switch2on",  Http_Command, Web_Switch2On },
+  { "/switch2off", Http_Command, Web_Switch2Off },
+};
+const uint8_t httpRouteCount = COUNT_OF(httpRoutes);
+
+// The page reads these names
+const JsonField httpStateSchema[] = {
+  JSON_FIELD("switch1",      Json_Flag, ControlState, switch1),
+  JSON_FIELD("switch2",      Json_Flag, ControlState, switch2),
+  JSON_FIELD("state1",       Json_Flag, ControlState, state1),
+  JSON_FIELD("state2",       Json_Flag, ControlState, state2),
+  JSON_FIELD("edgeLatUs",    Json_U32,  ControlState, edgeLatUs),
+  JSON_FIELD("edgeLatMaxUs", Json_U32,  ControlState, edgeLatMaxUs),
+  JSON_FIELD("edgeLatAvgUs", Json_U32,  ControlState, edgeLatAvgUs),
+};
+const uint8_t httpStateFieldCount = JSON_COUNT(httpStateSchema);
+
+void httpSite_reply(JsonWriter& json, const WebReply&) {
+  json.beginObject().endObject();
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+
+// What this sketch's web server serves (see HttpTask.h). The routes and the
+// /state schema are in HttpSite.cpp.
+
+#define HttpSite_StateBytes  192   // /state as an event, see httpStateSchema
+#define HttpSite_ReplyBytes  8     // no route here waits on loop()
+
+enum WebCommandType : uint8_t {
+  Web_Switch1On,    // E-STOP asserted
+  Web_Switch1Off,   // E-STOP cleared
+  Web_Switch2On,    // request raise
+  Web_Switch2Off    // request lower
+};
+
+struct WebReply {
+  uint16_t ticket;
+};
+
+struct ControlState {
+  bool switch1, switch2, state1, state2;
+  uint32_t edgeLatUs, edgeLatMaxUs, edgeLatAvgUs;  // see InputLatency
+};
+
+// What the page lights up for; the latencies only ride along
+inline bool sameLights(const ControlState& a, const ControlState& b) {
+  return a.switch1 == b.switch1 && a.switch2 == b.switch2
+      && a.state1 == b.state1 && a.state2 == b.state2;
+}
@@ -0,0 +1,503 @@
+#include "HttpTask.h"
+#include "WebPageHtml.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#ifndef ESP32
+#include <thread>
+#include <chrono>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+SpscRing<WebCommand, HttpTask_QueueSize> webCommands;
+SpscRing<WebReply, HttpTask_ReplyQueueSize> webReplies;
+SpscRing<ControlState, HttpTask_QueueSize> controlStates;
+
+enum ConnMode : uint8_t {
+    Conn_Free,
+    Conn_Reading,       // until the blank line after the headers
+    Conn_Waiting,       // on loop() for a WebReply (Http_Reply)
+    Conn_Writing,       // a response, then close
+    Conn_Stream         // /events, open until the client goes
+};
+
+struct Connection {
+    int fd;
+    ConnMode mode;
+    WebCommandType command;     // Conn_Waiting: what to ask loop()...
+    uint16_t ticket;            // ...and the reply it wants, 0 until asked
+    uint32_t sinceMs;           // accepted / last progress; a stream: when it opened
+    uint16_t reqLen;
+    char req[HttpTask_RequestBytes];
+    char out[HttpTask_OutBytes];    // still to send...
+    uint16_t outLen;
+    uint16_t outSent;
+    const uint8_t* blob;        // ...and then this, from flash or a static buffer
+    uint32_t blobLen;
+    uint32_t blobSent;
+};
+
+static Connection conns[HttpTask_MaxConnections];
+static int listenFd = -1;
+static uint16_t nextTicket = 0;
+static ControlState latest;             // newest from loop()
+static bool haveState = false;
+static char stateEvent[HttpSite_StateBytes];    // latest as "event: state\ndata: {...}\n\n"
+static uint16_t stateEventLen = 0;
+static const char* stateBody = NULL;            // the JSON in it, for /state
+static uint16_t stateBodyLen = 0;
+static char replyBody[HttpSite_ReplyBytes];     // one Http_Reply response at a time
+static ControlState lastStreamed;
+static uint32_t lastStreamedMs = 0;
+
+static uint32_t nowMs() {
+#ifdef ESP32
+    return millis();
+#else
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+#endif
+}
+
+static bool wouldBlock() {
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+}
+
+static void setNonBlocking(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+static void closeConn(Connection& c) {
+    close(c.fd);
+    c.fd = -1;
+    c.mode = Conn_Free;
+    c.blob = NULL;
+}
+
+static Connection* freeSlot() {
+    for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+        if (conns[i].mode == Conn_Free) return &conns[i];
+    }
+    return NULL;
+}
+
+// ---- responses ----
+
+static const char* statusText(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 408: return "Request Timeout";
+        case 431: return "Request Header Fields Too Large";
+        case 503: return "Service Unavailable";
+        default:  return "Error";
+    }
+}
+
+static bool append(Connection& c, const char* data, size_t len) {
+    if (c.outLen + len > sizeof(c.out)) return false;
+    memcpy(c.out + c.outLen, data, len);
+    c.outLen += len;
+    return true;
+}
+
+static bool append(Connection& c, const char* text) {
+    return append(c, text, strlen(text));
+}
+
+static void appendU32(Connection& c, uint32_t v) {
+    char digits[11];
+    append(c, digits, JsonWriter::formatU32(digits, v));
+}
+
+static void head(Connection& c, int status) {
+    c.outLen = c.outSent = 0;
+    c.blob = NULL;
+    c.blobLen = c.blobSent = 0;
+    append(c, "HTTP/1.1 ");
+    appendU32(c, status);
+    append(c, " ");
+    append(c, statusText(status));
+    append(c, "\r\nConnection: close\r\n");
+    c.mode = Conn_Writing;
+}
+
+static void contentHeaders(Connection& c, const char* type, uint32_t length) {
+    append(c, "Content-Type: ");    append(c, type);        append(c, "\r\n");
+    append(c, "Content-Length: ");  appendU32(c, length);   append(c, "\r\n\r\n");
+}
+
+// Every body sent this way is small and bounded, so it always fits
+static void respond(Connection& c, int status, const char* type, const char* body, size_t len) {
+    head(c, status);
+    contentHeaders(c, type, len);
+    if (!append(c, body, len)) closeConn(c);
+}
+
+static void respond(Connection& c, int status, const char* text) {
+    respond(c, status, "text/plain", text, strlen(text));
+}
+
+// The value of the named request header (any case), or NULL
+static const char* findHeader(const Connection& c, const char* name, uint16_t& len) {
+    size_t n = strlen(name);
+    const char* line = strstr(c.req, "\r\n");      // past the request line
+    while (line && line[2] != '\r') {
+        line += 2;
+        const char* end = strstr(line, "\r\n");
+        if (!end) return NULL;
+        if ((size_t)(end - line) > n && line[n] == ':' && strncasecmp(line, name, n) == 0) {
+            const char* v = line + n + 1;
+            while (*v == ' ') v++;
+            len = end - v;
+            return v;
+        }
+        line = end;
+    }
+    return NULL;
+}
+
+// The control page from flash (WebPageHtml.h), or a 304 if the browser
+// already has it. The ETag is fixed at build time from the content, and
+// "no-cache" makes the browser ask before it reuses its copy, so a new
+// firmware's page is picked up on the next load.
+static void sendPage(Connection& c) {
+    uint16_t len = 0;
+    const char* known = findHeader(c, "If-None-Match", len);
+    bool fresh = false;
+    if (known) {
+        char tags[96];
+        if (len >= sizeof(tags)) len = sizeof(tags) - 1;
+        memcpy(tags, known, len);
+        tags[len] = '\0';
+        fresh = strcmp(tags, "*") == 0 || strstr(tags, webPage_gzETag) != NULL;
+    }
+    head(c, fresh ? 304 : 200);
+    append(c, "ETag: " webPage_gzETag "\r\n");
+    append(c, "Cache-Control: no-cache\r\n");
+    if (fresh) {
+        append(c, "\r\n");
+        return;
+    }
+    append(c, "Content-Encoding: gzip\r\n");
+    contentHeaders(c, "text/html", webPage_gzLength);
+    c.blob = webPage_gz;
+    c.blobLen = webPage_gzLength;
+}
+
+// Once per ControlState: the event streams send all of stateEvent, /state
+// the JSON in the middle of it
+static void renderState() {
+    static const char prefix[] = "event: state\ndata: ";
+    const size_t start = sizeof(prefix) - 1;
+    memcpy(stateEvent, prefix, start);
+    JsonWriter json(stateEvent + start, sizeof(stateEvent) - start - 2);
+    json.object(httpStateSchema, httpStateFieldCount, &latest);
+    stateBody = stateEvent + start;
+    stateBodyLen = json.length();
+    memcpy(stateEvent + start + stateBodyLen, "\n\n", 2);
+    stateEventLen = start + stateBodyLen + 2;
+}
+
+static void sendState(Connection& c) {
+    if (haveState) respond(c, 200, "application/json", stateBody, stateBodyLen);
+    else           respond(c, 503, "Starting");     // loop() hasn't published yet
+}
+
+// ---- /events ----
+
+static void queueOut(Connection& c, const char* msg, size_t len) {
+    if (c.outSent) {
+        memmove(c.out, c.out + c.outSent, c.outLen - c.outSent);
+        c.outLen -= c.outSent;
+        c.outSent = 0;
+    }
+    if (!append(c, msg, len)) closeConn(c);     // a buffer behind: not reading; it'll reconnect if it's still there
+}
+
+static void openStream(Connection& c, uint32_t now) {
+    // Room for this one: the oldest stream goes
+    Connection* oldest = NULL;
+    uint8_t streams = 0;
+    for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+        if (conns[i].mode != Conn_Stream) continue;
+        streams++;
+        if (!oldest || now - conns[i].sinceMs > now - oldest->sinceMs) oldest = &conns[i];
+    }
+    if (streams >= HttpTask_MaxStreams) closeConn(*oldest);
+
+    c.outLen = c.outSent = 0;
+    append(c, "HTTP/1.1 200 OK\r\n"
+              "Content-Type: text/event-stream\r\n"
+              "Cache-Control: no-cache\r\n"
+              "Connection: keep-alive\r\n"
+              "\r\n");
+    append(c, "retry: ");
+    appendU32(c, HttpTask_RetryMs);
+    append(c, "\n\n");
+    if (haveState) append(c, stateEvent, stateEventLen);   // the page starts from the current state
+    c.mode = Conn_Stream;
+    c.sinceMs = now;
+}
+
+static void pushStreams(uint32_t now) {
+    if (!haveState) return;
+    if (sameLights(latest, lastStreamed) && now - lastStreamedMs < HttpTask_HeartbeatMs) return;
+    for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+        if (conns[i].mode == Conn_Stream) queueOut(conns[i], stateEvent, stateEventLen);
+    }
+    lastStreamed = latest;
+    lastStreamedMs = now;
+}
+
+// ---- requests ----
+
+// A button press: queued for loop(), and the page comes back as it always has
+static void command(Connection& c, WebCommandType type) {
+    WebCommand cmd = { type, 0 };
+    if (!webCommands.push(cmd)) {
+        respond(c, 503, "Busy");
+        return;
+    }
+    sendPage(c);
+}
+
+// Something only loop() can answer. The connection waits, queued with no
+// ticket until the reply before it is done (see askReply)
+static void waitForReply(Connection& c, WebCommandType type, uint32_t now) {
+    c.mode = Conn_Waiting;
+    c.command = type;
+    c.ticket = 0;
+    c.sinceMs = now;
+}
+
+static void route(Connection& c, uint32_t now) {
+    if (strncmp(c.req, "GET ", 4) != 0) {
+        respond(c, 405, "GET only");
+        return;
+    }
+    const char* path = c.req + 4;
+    size_t len = strcspn(path, " ?\r\n");
+    for (uint8_t i = 0; i < httpRouteCount; i++) {
+        const HttpRoute& r = httpRoutes[i];
+        if (strlen(r.path) != len || memcmp(path, r.path, len) != 0) continue;
+        switch (r.action) {
+            case Http_Page:     sendPage(c);                        break;
+            case Http_State:    sendState(c);                       break;
+            case Http_Events:   openStream(c, now);                 break;
+            case Http_Command:  command(c, r.command);              break;
+            case Http_Reply:    waitForReply(c, r.command, now);    break;
+        }
+        return;
+    }
+    respond(c, 404, "Not found");
+}
+
+static void readSome(Connection& c, uint32_t now) {
+    int n = recv(c.fd, c.req + c.reqLen, HttpTask_RequestBytes - 1 - c.reqLen, 0);
+    if (n == 0 || (n < 0 && !wouldBlock())) {
+        closeConn(c);
+        return;
+    }
+    if (n < 0) return;
+    c.reqLen += n;
+    c.req[c.reqLen] = '\0';
+    if (strstr(c.req, "\r\n\r\n")) route(c, now);
+    else if (c.reqLen == HttpTask_RequestBytes - 1) respond(c, 431, "Request too large");
+}
+
+// A stream client has nothing to say; anything readable is it hanging up
+static void drainStream(Connection& c) {
+    char scratch[64];
+    int n = recv(c.fd, scratch, sizeof(scratch), 0);
+    if (n == 0 || (n < 0 && !wouldBlock())) closeConn(c);
+}
+
+template <typename N>
+static bool sendSome(Connection& c, const uint8_t* data, uint32_t len, N& sent, uint32_t now) {
+    while (sent < len) {
+        int n = send(c.fd, data + sent, len - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            if (n < 0 && wouldBlock()) return false;
+            closeConn(c);
+            return false;
+        }
+        sent += n;
+        if (c.mode == Conn_Writing) c.sinceMs = now;
+    }
+    return true;
+}
+
+static void writeSome(Connection& c, uint32_t now) {
+    if (!sendSome(c, (const uint8_t*)c.out, c.outLen, c.outSent, now)) return;
+    if (c.blob && !sendSome(c, c.blob, c.blobLen, c.blobSent, now)) return;
+    if (c.mode == Conn_Writing) {
+        closeConn(c);
+    } else {
+        c.outLen = c.outSent = 0;     // a stream that has caught up
+    }
+}
+
+static void acceptAll(uint32_t now) {
+    Connection* c;
+    while ((c = freeSlot()) != NULL) {
+        int fd = accept(listenFd, NULL, NULL);
+        if (fd < 0) return;
+        setNonBlocking(fd);
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));   // small writes go out now
+        c->fd = fd;
+        c->mode = Conn_Reading;
+        c->sinceMs = now;
+        c->reqLen = 0;
+        c->req[0] = '\0';
+        c->outLen = c->outSent = 0;
+        c->blob = NULL;
+        c->blobLen = c->blobSent = 0;
+    }
+}
+
+// A client that won't finish its request or take its response, or a reply
+// loop() never sent, gives its slot back
+static void expire(uint32_t now) {
+    for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+        Connection& c = conns[i];
+        if (c.mode == Conn_Free || c.mode == Conn_Stream || now - c.sinceMs <= HttpTask_IdleMs) continue;
+        if (c.mode == Conn_Reading)         respond(c, 408, "Timed out");
+        else if (c.mode == Conn_Waiting)    respond(c, 503, "No reply");
+        else                                closeConn(c);
+        c.sinceMs = now;
+    }
+}
+
+// ---- queues ----
+
+// The reply is written into replyBody and sent from there, so one is asked
+// for (or sent) at a time and the rest wait their turn, oldest first. A
+// push that doesn't fit is tried again next time round.
+static void askReply(uint32_t now) {
+    Connection* next = NULL;
+    for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+        Connection& c = conns[i];
+        if (c.mode == Conn_Writing && c.blob == (const uint8_t*)replyBody) return;
+        if (c.mode != Conn_Waiting) continue;
+        if (c.ticket) return;
+        if (!next || now - c.sinceMs > now - next->sinceMs) next = &c;
+    }
+    if (!next) return;
+    if (++nextTicket == 0) nextTicket = 1;     // 0 is "not asked yet"
+    WebCommand cmd = { next->command, nextTicket };
+    if (webCommands.push(cmd)) next->ticket = cmd.ticket;
+}
+
+static void sendReply(Connection& c, const WebReply& reply) {
+    JsonWriter json(replyBody, sizeof(replyBody));
+    httpSite_reply(json, reply);
+    head(c, 200);
+    contentHeaders(c, "application/json", json.length());
+    c.blob = (const uint8_t*)replyBody;
+    c.blobLen = json.length();
+}
+
+static void drainQueues() {
+    bool fresh = false;
+    while (controlStates.pop(latest)) fresh = true;
+    if (fresh) {
+        haveState = true;
+        renderState();
+    }
+    static WebReply reply;      // can be big; kept off the task's stack
+    while (webReplies.pop(reply)) {     // one whose client has gone is dropped
+        for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+            if (conns[i].mode == Conn_Waiting && conns[i].ticket == reply.ticket) {
+                sendReply(conns[i], reply);
+                break;
+            }
+        }
+    }
+}
+
+static void httpTask(void*) {
+    for (;;) {
+        uint32_t now = nowMs();
+        drainQueues();
+        askReply(now);
+        pushStreams(now);
+        expire(now);
+
+        fd_set rd, wr;
+        FD_ZERO(&rd);
+        FD_ZERO(&wr);
+        int top = -1;
+        if (freeSlot()) {           // else new clients wait in the listen backlog
+            FD_SET(listenFd, &rd);
+            top = listenFd;
+        }
+        for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+            Connection& c = conns[i];
+            if (c.mode == Conn_Reading || c.mode == Conn_Stream) FD_SET(c.fd, &rd);
+            if (c.mode == Conn_Writing || (c.mode == Conn_Stream && c.outLen)) FD_SET(c.fd, &wr);
+            if (c.mode != Conn_Free && c.mode != Conn_Waiting && c.fd > top) top = c.fd;
+        }
+        struct timeval tv;
+        tv.tv_sec = 0;
+        tv.tv_usec = HttpTask_WaitMs * 1000;
+        if (select(top + 1, &rd, &wr, NULL, &tv) <= 0) continue;
+
+        now = nowMs();
+        for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+            Connection& c = conns[i];
+            if (c.mode == Conn_Free) continue;
+            int fd = c.fd;
+            if (FD_ISSET(fd, &rd)) {
+                if (c.mode == Conn_Reading) readSome(c, now);
+                else if (c.mode == Conn_Stream) drainStream(c);
+            }
+            if (c.mode != Conn_Free && FD_ISSET(fd, &wr)) writeSome(c, now);
+        }
+        // after the connections, so a fd closed above can't be mistaken for a new one
+        if (FD_ISSET(listenFd, &rd)) acceptAll(now);
+    }
+}
+
+bool httpTask_init(uint16_t port) {
+    for (uint8_t i = 0; i < HttpTask_MaxConnections; i++) {
+        conns[i].fd = -1;
+        conns[i].mode = Conn_Free;
+    }
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) return false;
+    int one = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(listenFd, HttpTask_MaxConnections) < 0) {
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+    setNonBlocking(listenFd);
+#ifdef ESP32
+    xTaskCreatePinnedToCore(httpTask, "http", HttpTask_StackBytes, NULL,
+                            HttpTask_Priority, NULL, HttpTask_Core);
+#else
+    std::thread(httpTask, nullptr).detach();     // host build: a thread stands in for the task
+#endif
+    return true;
+}
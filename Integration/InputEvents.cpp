@@ -0,0 +1,15 @@
+#include "InputEvents.h"
+// Only the edge ISR lives here; it has to be out of line to sit in IRAM.
+
+void IRAM_ATTR InputEvents::edgeISR(void* arg) {
+  Line* l = (Line*)arg;
+  portENTER_CRITICAL_ISR(&l->owner->_lock);     // see reconcile()
+  uint32_t now = micros();
+  bool on = digitalRead(l->pin) == LOW;
+  if (now - l->lastUs >= INPUT_DEBOUNCE_US && on != l->stable) {   // else still bouncing
+    l->stable = on;
+    l->lastUs = now;
+    l->owner->_q.push(InputEvent{ now, l->id, on });
+  }
+  portEXIT_CRITICAL_ISR(&l->owner->_lock);
+}
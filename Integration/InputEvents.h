@@ -0,0 +1,121 @@
+#pragma once
+#include <Arduino.h>
+#include "Config.h"
+#include "SpscRing.h"
+
+// Interrupt-driven inputs: limit switches, E-stop and the panel buttons.
+// Each pin has a CHANGE interrupt that timestamps the edge and queues it, so
+// an edge shorter than a loop() pass is still seen by the FSM. Debounce is
+// leading-edge: the first edge is taken at once (no added latency) and the
+// line is then locked out for INPUT_DEBOUNCE_US; collect() re-reads any line
+// whose lockout has ended in case the bounce settled on the other level.
+
+enum InputId : uint8_t { IN_TOP, IN_BOT, IN_ESTOP, IN_RAISE, IN_LOWER, IN_ABORT, IN_COUNT };
+
+struct InputEvent {
+  uint32_t tUs;     // micros() at the edge
+  uint8_t  id;      // InputId
+  bool     on;      // true = pressed (all inputs are active-low)
+};
+
+// What one FSM tick sees. held() is the debounced level OR'd with any press
+// that happened since the previous collect(), so a tap is never lost.
+struct InputSnapshot {
+  uint8_t  held    = 0;   // bit per InputId
+  uint8_t  edges   = 0;   // events consumed for this tick
+  uint32_t firstUs = 0;   // timestamp of the oldest of them
+  bool is(InputId i) const { return held & (1u << i); }
+};
+
+// Edge -> FSM reaction time, in microseconds.
+struct InputLatency {
+  uint32_t lastUs  = 0;
+  uint32_t maxUs   = 0;
+  uint32_t count   = 0;
+  uint64_t totalUs = 0;
+  uint32_t avgUs() const { return count ? (uint32_t)(totalUs / count) : 0; }
+};
+
+class InputEvents {
+public:
+  InputEvents(uint8_t pinTop, uint8_t pinBot, uint8_t pinEstop,
+              uint8_t pinRaise, uint8_t pinLower, uint8_t pinAbort) {
+    const uint8_t pins[IN_COUNT] = { pinTop, pinBot, pinEstop, pinRaise, pinLower, pinAbort };
+    for (uint8_t i = 0; i < IN_COUNT; i++) {
+      _line[i].owner = this; _line[i].pin = pins[i]; _line[i].id = i;
+    }
+  }
+
+  void begin() {
+    uint32_t now = micros();
+    for (uint8_t i = 0; i < IN_COUNT; i++) {
+      Line& l = _line[i];
+      pinMode(l.pin, INPUT_PULLUP);
+      l.stable = digitalRead(l.pin) == LOW;
+      l.lastUs = now - INPUT_DEBOUNCE_US;
+      attachInterruptArg(digitalPinToInterrupt(l.pin), edgeISR, &l, CHANGE);
+    }
+  }
+
+  // Consumer side, once per tick: settle lockouts, drain the queue.
+  InputSnapshot collect() {
+    reconcile();
+    InputSnapshot s;
+    InputEvent e;
+    while (_q.pop(e)) {
+      if (!s.edges) s.firstUs = e.tUs;
+      if (s.edges < 255) s.edges++;
+      if (e.on) s.held |= 1u << e.id;
+    }
+    for (uint8_t i = 0; i < IN_COUNT; i++)
+      if (_line[i].stable) s.held |= 1u << i;
+    return s;
+  }
+
+  // Called once the FSM has acted on a snapshot with edges in it.
+  void noteReaction(uint32_t edgeUs, uint32_t nowUs) {
+    uint32_t d = nowUs - edgeUs;
+    _lat.lastUs = d;
+    if (d > _lat.maxUs) _lat.maxUs = d;
+    _lat.count++;
+    _lat.totalUs += d;
+  }
+
+  const InputLatency& latency() const { return _lat; }
+  uint32_t dropped() const { return _q.dropped(); }
+
+private:
+  struct Line {
+    InputEvents* owner = nullptr;
+    uint8_t pin = 0, id = 0;
+    volatile bool stable = false;       // debounced level, true = pressed
+    volatile uint32_t lastUs = 0;       // last accepted edge (start of lockout)
+  };
+
+  static void edgeISR(void* arg);
+
+  // Lines whose lockout has expired but whose pin no longer matches the
+  // accepted level get a synthesized edge. The ISR takes the same lock, so
+  // the two stay a single producer for the ring and can't both update a
+  // line; noInterrupts() is a no-op on the ESP32 core and can't do that.
+  // The time is read under the lock, so it is never older than an edge the
+  // ISR has just stamped.
+  void reconcile() {
+    for (uint8_t i = 0; i < IN_COUNT; i++) {
+      Line& l = _line[i];
+      portENTER_CRITICAL(&_lock);
+      uint32_t now = micros();
+      bool on = digitalRead(l.pin) == LOW;
+      if (on != l.stable && now - l.lastUs >= INPUT_DEBOUNCE_US) {
+        l.stable = on; l.lastUs = now;
+        _q.push(InputEvent{ now, i, on });
+      }
+      portEXIT_CRITICAL(&_lock);
+    }
+  }
+
+  Line _line[IN_COUNT];
+  SpscRing<InputEvent, INPUT_QUEUE_LEN> _q;
+  portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;  // edgeISR vs reconcile()
+  InputLatency _lat;
+};
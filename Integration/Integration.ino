@@ -1,14 +1,13 @@
 #include <Arduino.h>
 #include "Config.h"   
 #include "main.h"
-#include "Motor.h"
-#include "LimitSwitch.h"
+#include "InputEvents.h"
 #include "Ultrasonic.h"
 #include "Webpage.h"
 
 // Singletons
-Motor       Act;
-LimitSwitch Limits(PIN_LIM_TOP, PIN_LIM_BOT, PIN_ESTOP);
+InputEvents Inputs(PIN_LIM_TOP, PIN_LIM_BOT, PIN_ESTOP,
+                   PIN_BTN_RAISE, PIN_BTN_LOWER, PIN_BTN_ABORT);
 Ultrasonic  SonarWait(PIN_TRIG_WAIT,  PIN_ECHO_WAIT);
 Ultrasonic  SonarUnder(PIN_TRIG_UNDER, PIN_ECHO_UNDER);
 
@@ -24,72 +23,29 @@ int invertedDutyFromSpeed(int speed, int maxSpeed = 255) {
 // int duty = invertedDutyFromSpeed(currentSpeed, 255);
 
 
-// ---------- Low-level hooks used by Motor (requested: PWM write in .ino) ----------
-void motorHwEnable()   {/* EN pin high if you have one */}
-void motorHwDisable()  {/* EN pin low  */}
-void motorHwDirUp()    { digitalWrite(PIN_MOTOR_DIR, HIGH); }
-void motorHwDirDown()  { digitalWrite(PIN_MOTOR_DIR, LOW);  }
-void motorHwWritePWM(int duty255) {
-  duty255 = constrain(duty255, 0, 255);
-  analogWrite(PIN_MOTOR_PWM, duty255);
-}
-
-// ---------- Lights / gates (stubs) ----------
-void roadGreen()  {}
-void roadYellow() {}
-void roadRed()    {}
-void marineGreen(){}
-void marineRed()  {}
-void gatesUp()    {}
-void gatesDown()  {}
-bool gatesAreDown(){ return true; }
-
-// ---------- Other inputs ----------
-bool carOnBridge()   { /* pressure plates */ return false; }
-bool boatWaiting()   { return SonarWait.distanceMM()  < BOAT_WAITING_MM; }
-bool boatUnderSpan() { return SonarUnder.distanceMM() < BOAT_UNDER_MM;   }
-
 // ---------- Wiring the world ----------
+// (motor, lights and gates are the hardware policy in Hardware.h)
 void setup() {
   Serial.begin(115200);
-  pinMode(PIN_MOTOR_DIR, OUTPUT);
-  pinMode(PIN_MOTOR_PWM, OUTPUT);
-  pinMode(PIN_BTN_RAISE, INPUT_PULLUP);
-  pinMode(PIN_BTN_LOWER, INPUT_PULLUP);
-  pinMode(PIN_BTN_ABORT, INPUT_PULLUP);
-
 
+  // Initialise sensors (limit switches, E-stop and buttons are interrupt driven)
+  Inputs.begin();
 
-  // Initialise sensors
-  Limits.begin();
-  SonarWait.begin();
-  SonarUnder.begin();
-
-  // Provide the Motor wrapper with our low-level hooks
-  Act.bind(motorHwEnable, motorHwDisable, motorHwDirUp, motorHwDirDown, motorHwWritePWM);
-
-  // Pass config object (optional, uses default if omitted)
-  Main_init(&Act, &Limits, &SonarWait, &SonarUnder);
+  // Pass config object (optional, uses default if omitted); this also sets
+  // up the sonars and the motor pins through the hardware policy
+  Main_init(&Inputs, &SonarWait, &SonarUnder);
   Webpage_init();
 }
 
 void loop() {
-  Webpage_poll();
-  // Read buttons (active-low)
-  bool reqRaiseBtn = digitalRead(PIN_BTN_RAISE) == LOW;
-  bool reqLowerBtn = digitalRead(PIN_BTN_LOWER) == LOW;
-  bool reqAbortBtn = digitalRead(PIN_BTN_ABORT) == LOW;
-  bool reqRaise = reqRaiseBtn || Web_reqRaise();
-  bool reqLower = reqLowerBtn || Web_reqLower();
-  bool reqAbort = reqAbortBtn || Web_reqAbort();
-
-  // Provide environment (lights/gates + sensors) via callbacks
-  Main_setEnvironment(roadGreen, roadYellow, roadRed,
-                      marineGreen, marineRed,
-                      gatesUp, gatesDown, gatesAreDown,
-                      carOnBridge, boatWaiting, boatUnderSpan);
-
-  // Run FSM
-  Main_tick(reqRaise, reqLower, reqAbort, millis());
+  Webpage_poll(); // the web server itself runs in its own task
+
+  // Snapshot all sensors once, then run FSM on that snapshot
+  SensorFrame frame = Main_sense(millis());
+  bool reqRaise = frame.btnRaise || Web_reqRaise();
+  bool reqLower = frame.btnLower || Web_reqLower();
+  bool reqAbort = frame.btnAbort || Web_reqAbort();
+  Main_tick(frame, reqRaise, reqLower, reqAbort);
   Web_setState(reqAbort?1:0, reqRaise?1:0); // simple mapping
+  Webpage_publish(millis());
 }
@@ -1,2 +0,0 @@
-#include "LimitSwitch.h"
-// All logic header-only for simplicity.
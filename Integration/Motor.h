@@ -1,23 +1,18 @@
 #pragma once
 #include <Arduino.h>
 
-// Low-level hardware is supplied by Integration.ino
-using MotorVoid = void (*)();
-using MotorPWM  = void (*)(int duty255);
-
+// Motor wrapper over a hardware policy (see Hardware.h). Hw's motor calls
+// are resolved at compile time; the wrapper only remembers the last duty.
+template <class Hw>
 class Motor {
 public:
-  void bind(MotorVoid en, MotorVoid dis, MotorVoid up, MotorVoid down, MotorPWM write) {
-    _en=en; _dis=dis; _up=up; _down=down; _write=write;
-  }
-  void enable()  { if (_en)  _en();  }
-  void disable() { if (_dis) _dis(); }
-  void dirUp()   { if (_up)  _up();  }
-  void dirDown() { if (_down)_down();}
-  void setSpeed(int duty255) { if (_write) _write(duty255); _last=duty255; }
+  void enable()  { Hw::motorEnable();  }
+  void disable() { Hw::motorDisable(); }
+  void dirUp()   { Hw::motorDirUp();   }
+  void dirDown() { Hw::motorDirDown(); }
+  void setSpeed(int duty255) { Hw::motorWritePWM(duty255); _last=duty255; }
   void stop() { setSpeed(0); }
   int  last() const { return _last; }
 private:
-  MotorVoid _en=nullptr,_dis=nullptr,_up=nullptr,_down=nullptr; MotorPWM _write=nullptr;
   int _last=0;
 };
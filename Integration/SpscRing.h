@@ -0,0 +1,49 @@
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Single-producer / single-consumer lock-free ring.
+// One task push()es, one task pop()s; neither ever blocks or takes a lock.
+// N must be a power of two so the indices can wrap with a mask.
+template <typename T, uint32_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+    private:
+        T buf[N];
+        std::atomic<uint32_t> head;     // next slot to write, producer owned
+        std::atomic<uint32_t> tail;     // next slot to read, consumer owned
+        std::atomic<uint32_t> drops;    // pushes refused because the ring was full
+    public:
+        SpscRing() : head(0), tail(0), drops(0) {}
+
+        // Producer side. Returns false (and counts a drop) when full.
+        bool push(const T& item) {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) >= N) {
+                drops.store(drops.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+            buf[h & (N - 1)] = item;
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. Returns false when empty.
+        bool pop(T& out) {
+            uint32_t t = tail.load(std::memory_order_relaxed);
+            if (t == head.load(std::memory_order_acquire)) return false;
+            out = buf[t & (N - 1)];
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint32_t size() const {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+        uint32_t dropped() const { return drops.load(std::memory_order_relaxed); }
+        static uint32_t capacity() { return N; }
+};
+
+#endif
@@ -1,2 +1,2 @@
 #include "Ultrasonic.h"
-// Everything is already implemented inline for brevity.
+// Everything is already implemented inline for brevity (echo ISR lives in EchoCapture.cpp).
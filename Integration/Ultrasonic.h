@@ -1,18 +1,29 @@
 #pragma once
 #include <Arduino.h>
+#include "EchoCapture.h"
+#include "Units.h"
 
+// One HC-SR04. Pings are fired by the SonicScheduler in main.cpp, one sensor
+// at a time, which also runs each echo through that sensor's filter.
 class Ultrasonic {
 public:
-  Ultrasonic(int trig, int echo) : _trig(trig), _echo(echo) {}
-  void begin() { pinMode(_trig, OUTPUT); pinMode(_echo, INPUT); digitalWrite(_trig, LOW); }
-  long distanceMM() {
-    // very light pseudo: you will replace with a robust median filter
-    digitalWrite(_trig, LOW); delayMicroseconds(3);
-    digitalWrite(_trig, HIGH); delayMicroseconds(10);
-    digitalWrite(_trig, LOW);
-    unsigned long us = pulseIn(_echo, HIGH, 30000); // 30ms timeout
-    return (long)(us * 0.343 / 2.0); // mm at ~20°C
+  Ultrasonic(int trig, int echo) : _cap(trig, echo) {}
+  void init() { _cap.init(); }
+  // Fire a ping if the previous one has landed; returns at once.
+  void trigger() { _cap.trigger(); }
+  // The last ping is still in the air (or its no-echo pulse is still high).
+  bool busy() { return _cap.busy(); }
+  // Latest completed echo with its timestamp (interrupt captured, never blocks).
+  bool latest(EchoSample& s) const { return _cap.latest(s); }
+  // Distance of the newest echo, only if it arrived since the last call.
+  bool readEcho(DistanceMM& d) {
+    EchoSample s;
+    if (!_cap.latest(s) || s.count == _seen) return false;
+    _seen = s.count;
+    d = DistanceMM::fromEcho(EchoTimeUS(s.widthUs));
+    return true;
   }
 private:
-  int _trig,_echo;
+  EchoCapture _cap;
+  uint32_t _seen = 0;
 };
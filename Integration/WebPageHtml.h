@@ -0,0 +1,84 @@
+// Auto-generated by Convert on 2026-10-16 23:51:31 from webPageIntegration.html
+// 2230 bytes of HTML, gzip-compressed to 1047. Send it as is
+// with Content-Encoding: gzip. The hash is FNV-1a of the compressed bytes,
+// and the ETag is the hash quoted, so it changes exactly when the page does.
+
+#ifndef WEBPAGEHTML_H
+#define WEBPAGEHTML_H
+
+#include <Arduino.h>
+
+#define webPage_gzHash     0x053ef16fUL
+#define webPage_gzETag     "\"053ef16f\""
+#define webPage_gzLength   1047
+
+const uint8_t webPage_gz[webPage_gzLength] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x85, 0x56, 0xdb, 0x6e, 0xdb, 0x38,
+    0x10, 0x7d, 0xf7, 0x57, 0xb0, 0xe8, 0x03, 0x25, 0xd4, 0x96, 0x6d, 0x7a, 0x91, 0x0d, 0x24, 0xcb,
+    0x45, 0x9a, 0x4d, 0x80, 0x2c, 0x82, 0xba, 0x88, 0x0b, 0x04, 0xfb, 0x48, 0x4b, 0x23, 0x89, 0x2d,
+    0x4d, 0x0a, 0x22, 0x7d, 0xab, 0xe0, 0x7f, 0xdf, 0xa1, 0x24, 0x3b, 0x6e, 0x73, 0x83, 0x61, 0x4b,
+    0x9a, 0x39, 0x3c, 0x73, 0x38, 0x33, 0x1a, 0x7a, 0xfa, 0xe1, 0x9f, 0xf9, 0xf5, 0xf7, 0xff, 0xbe,
+    0xdd, 0x90, 0xc2, 0xae, 0xe4, 0xac, 0x37, 0x75, 0x17, 0x22, 0xb9, 0xca, 0x63, 0x0a, 0x8a, 0x3a,
+    0x03, 0xf0, 0x14, 0x2f, 0x2b, 0xb0, 0x9c, 0x24, 0x05, 0xaf, 0x0c, 0xd8, 0x98, 0xae, 0x6d, 0x36,
+    0xb8, 0xa4, 0xc3, 0xa3, 0x5d, 0xf1, 0x15, 0xc4, 0x74, 0x23, 0x60, 0x5b, 0xea, 0xca, 0x52, 0x92,
+    0x68, 0x65, 0x41, 0x21, 0x6e, 0x2b, 0x52, 0x5b, 0xc4, 0x29, 0x6c, 0x44, 0x02, 0x83, 0xe6, 0xa1,
+    0x2f, 0x94, 0xb0, 0x82, 0xcb, 0x81, 0x49, 0xb8, 0x84, 0x78, 0xdc, 0x90, 0x58, 0x61, 0x25, 0xcc,
+    0x1e, 0xaf, 0x2e, 0xc9, 0x35, 0xae, 0xac, 0xb4, 0x24, 0xdf, 0xb8, 0x02, 0x39, 0x1d, 0xb6, 0x8e,
+    0xde, 0xd4, 0xd8, 0xbd, 0xbb, 0x2e, 0x75, 0xba, 0xaf, 0x33, 0x84, 0x0c, 0x32, 0xbe, 0x12, 0x72,
+    0x1f, 0x5e, 0x55, 0x48, 0x15, 0xad, 0x78, 0x95, 0x0b, 0x15, 0x8e, 0xa2, 0x92, 0xa7, 0xa9, 0x50,
+    0x79, 0x38, 0x61, 0xe5, 0x2e, 0xb2, 0xb0, 0xb3, 0x03, 0x2e, 0x45, 0xae, 0xc2, 0x04, 0xc5, 0x40,
+    0x15, 0x25, 0x5a, 0xea, 0x2a, 0xfc, 0x38, 0x99, 0x4c, 0x0e, 0xbd, 0xa0, 0xd2, 0xdb, 0x3a, 0x15,
+    0xa6, 0x94, 0x7c, 0x1f, 0x66, 0x12, 0x76, 0xd1, 0x8f, 0xb5, 0xb1, 0x22, 0xdb, 0x0f, 0x3a, 0xf1,
+    0xc7, 0x45, 0x39, 0x2f, 0x43, 0x76, 0x89, 0x7c, 0x5d, 0x14, 0xf6, 0x57, 0xb9, 0x23, 0x23, 0x24,
+    0x58, 0x5a, 0x55, 0x1f, 0x03, 0x8e, 0x9d, 0xb1, 0x89, 0xba, 0xd4, 0x55, 0x0a, 0x15, 0x6a, 0x69,
+    0x6f, 0x06, 0x15, 0x4f, 0xc5, 0xda, 0x34, 0x80, 0xa8, 0x51, 0x6e, 0xc4, 0x2f, 0x08, 0xd9, 0x08,
+    0x1f, 0x3b, 0x39, 0x59, 0x96, 0x45, 0xc9, 0xba, 0x32, 0x78, 0x5f, 0x6a, 0xd1, 0xc4, 0x5c, 0xea,
+    0xdd, 0xc0, 0x14, 0x3c, 0xd5, 0xdb, 0x70, 0x44, 0x90, 0x95, 0x5c, 0xe0, 0xb7, 0xca, 0x97, 0xdc,
+    0x1b, 0xf5, 0xdd, 0x27, 0x60, 0x3e, 0x0a, 0xd0, 0xaa, 0x5e, 0xf2, 0xe4, 0x67, 0x5e, 0xe9, 0xb5,
+    0x4a, 0xc3, 0x8f, 0x0c, 0xfe, 0x4e, 0x27, 0xec, 0x10, 0xe8, 0x2c, 0xfb, 0xcd, 0x9e, 0x5c, 0xb0,
+    0x4b, 0x76, 0x79, 0x08, 0x90, 0xb4, 0x6e, 0x4a, 0x80, 0x62, 0x5c, 0xf8, 0x02, 0x44, 0x5e, 0xd8,
+    0x90, 0x5d, 0x9c, 0x54, 0xff, 0x26, 0xf6, 0x05, 0x8a, 0x9e, 0xe3, 0x78, 0x2d, 0xac, 0xb1, 0xdc,
+    0xae, 0x4d, 0xdd, 0x66, 0x69, 0x60, 0x75, 0x19, 0x4e, 0x46, 0xc7, 0x3d, 0x77, 0xd5, 0x5a, 0x69,
+    0xa5, 0x4d, 0xc9, 0x13, 0x38, 0xcb, 0x84, 0x8b, 0x75, 0xe8, 0x4d, 0x87, 0x5d, 0x85, 0xa7, 0xc3,
+    0xae, 0xdf, 0x5c, 0xa9, 0x5d, 0xf7, 0x8d, 0x9b, 0xb6, 0x58, 0x60, 0x92, 0x25, 0x90, 0x7b, 0xe0,
+    0x19, 0xf9, 0x52, 0x89, 0x34, 0x07, 0x04, 0x8e, 0x9d, 0x9f, 0xcd, 0x1e, 0x45, 0x05, 0x12, 0x8c,
+    0xf9, 0xb3, 0x77, 0xd0, 0xd5, 0x9b, 0xa6, 0x62, 0x43, 0x12, 0xc9, 0x8d, 0x89, 0x29, 0x16, 0x9c,
+    0xb6, 0x96, 0xd9, 0xb4, 0x98, 0xcc, 0x6e, 0x06, 0x0b, 0x14, 0x89, 0xb0, 0xc9, 0x6c, 0xba, 0x5c,
+    0x5b, 0xab, 0x15, 0x11, 0x69, 0x4c, 0xcd, 0x56, 0xd8, 0xa4, 0x18, 0xd3, 0xe3, 0x2a, 0xac, 0x32,
+    0xc1, 0x8c, 0xd2, 0xd9, 0xfc, 0xf6, 0x76, 0x3a, 0x6c, 0x81, 0xb3, 0xe9, 0xd0, 0xb1, 0x3c, 0x71,
+    0xb5, 0x92, 0x50, 0xc0, 0x6a, 0xc5, 0x55, 0xfa, 0x0a, 0x27, 0x7b, 0xce, 0x79, 0x3f, 0x7f, 0xbc,
+    0x79, 0x78, 0xc6, 0xfa, 0x44, 0xfe, 0x8a, 0xf4, 0x2b, 0x2c, 0x97, 0x6d, 0xa3, 0x38, 0x50, 0x13,
+    0x02, 0xb3, 0x0f, 0x67, 0xaa, 0xf5, 0x8e, 0x76, 0x7c, 0x7f, 0x6a, 0x7d, 0xe0, 0xc2, 0x60, 0x36,
+    0x5f, 0x58, 0xce, 0xde, 0x5a, 0xfe, 0x5c, 0x54, 0x5b, 0x70, 0x7a, 0x5a, 0x8f, 0xf7, 0x27, 0xb4,
+    0x49, 0x2a, 0x51, 0xda, 0x59, 0x2f, 0x5b, 0xab, 0xc4, 0x0a, 0x4c, 0x03, 0x6e, 0xd9, 0x03, 0xd9,
+    0xd7, 0xaa, 0x2f, 0xf9, 0x12, 0xe4, 0xfc, 0x78, 0xcd, 0x32, 0xbf, 0x06, 0x19, 0x34, 0x94, 0xf7,
+    0xc2, 0xd8, 0xc0, 0xea, 0x1c, 0x2b, 0xed, 0x51, 0xad, 0x28, 0xa2, 0xfd, 0xe8, 0x65, 0x27, 0x26,
+    0xaf, 0xff, 0xa1, 0x73, 0xbb, 0xf7, 0xfc, 0xba, 0x1b, 0x38, 0x5a, 0x7d, 0xee, 0xf8, 0xc3, 0x23,
+    0x7f, 0x74, 0x38, 0x53, 0xa1, 0x77, 0xad, 0x8a, 0x77, 0x82, 0x9e, 0x2d, 0xe1, 0x65, 0x29, 0xf7,
+    0x9e, 0xf1, 0x6b, 0xb7, 0x83, 0xe5, 0xb8, 0x6f, 0x82, 0xae, 0x43, 0xfa, 0x74, 0xfe, 0x95, 0xe2,
+    0xcf, 0xed, 0x2d, 0xf5, 0xa3, 0xc6, 0xc9, 0x4e, 0x4e, 0xd6, 0xa7, 0x0f, 0x57, 0x77, 0x8b, 0x1b,
+    0xf4, 0x37, 0x25, 0x76, 0x08, 0x0c, 0x6d, 0x6c, 0xb3, 0xbe, 0x29, 0xd5, 0xd1, 0xc2, 0x8e, 0x16,
+    0xe6, 0x47, 0x4e, 0xc9, 0xd9, 0x66, 0xe8, 0xc2, 0xd9, 0x43, 0xfa, 0xe9, 0xdf, 0xc5, 0xfc, 0x2b,
+    0x82, 0x2a, 0x2c, 0x1b, 0x0e, 0x28, 0x14, 0x73, 0x2e, 0xb0, 0xd4, 0x52, 0x7a, 0x7e, 0x9d, 0x01,
+    0xc6, 0xf5, 0xe8, 0xb0, 0xe1, 0xa2, 0x7e, 0x60, 0x0b, 0x50, 0x5e, 0x15, 0xcf, 0xaa, 0xe0, 0x87,
+    0xd1, 0xca, 0xf3, 0x3b, 0x4b, 0xb3, 0x1d, 0x3f, 0x48, 0xb8, 0x43, 0x7b, 0x7e, 0x3c, 0xab, 0x0f,
+    0x8e, 0x6d, 0x38, 0x24, 0xdf, 0x0b, 0x20, 0x06, 0xaa, 0x0d, 0x54, 0xa4, 0x5c, 0x9b, 0x02, 0x0c,
+    0x01, 0x9e, 0x14, 0x6e, 0xe4, 0xab, 0x1c, 0xa2, 0x26, 0x0c, 0xc6, 0x27, 0xc2, 0x10, 0xad, 0xe4,
+    0x9e, 0x20, 0x1b, 0xc9, 0xb8, 0x94, 0x6e, 0x14, 0xf4, 0x44, 0xe6, 0x6d, 0x85, 0xc2, 0x71, 0x15,
+    0xdc, 0x6c, 0x50, 0xf9, 0x42, 0xaf, 0xab, 0x04, 0xfc, 0x5a, 0xc1, 0x96, 0x9c, 0x19, 0x50, 0x1d,
+    0xb8, 0x27, 0x83, 0xf2, 0x70, 0x6e, 0x36, 0x1e, 0x97, 0x7e, 0x50, 0x50, 0x79, 0x6d, 0x0b, 0xd2,
+    0x3e, 0xc4, 0xb3, 0x36, 0xe5, 0xcd, 0xa6, 0x4b, 0x77, 0xde, 0x78, 0x10, 0xa4, 0xdc, 0x72, 0xdf,
+    0x47, 0xa5, 0x20, 0x0d, 0xd4, 0x78, 0x04, 0xdd, 0xb9, 0x39, 0xb9, 0xe1, 0xd2, 0x73, 0xba, 0xfa,
+    0xe3, 0xd1, 0x68, 0xe4, 0xb6, 0xd1, 0x89, 0x78, 0x4e, 0x2e, 0x35, 0x4f, 0x69, 0xdf, 0x61, 0xfd,
+    0xa8, 0x87, 0x03, 0xde, 0x58, 0xb2, 0x1c, 0xc7, 0xa9, 0x4e, 0xd6, 0x2b, 0xc4, 0x05, 0x39, 0xd8,
+    0x1b, 0x09, 0xee, 0xf6, 0xcb, 0xfe, 0x2e, 0xf5, 0x4e, 0x43, 0xc0, 0x8f, 0x3a, 0x2c, 0x7b, 0x0f,
+    0xcb, 0x4e, 0x58, 0x2c, 0xf2, 0x1b, 0xe0, 0xf6, 0x35, 0x7d, 0xc2, 0xb2, 0x77, 0xb0, 0xe7, 0xbc,
+    0x6f, 0x43, 0xf1, 0xf5, 0xc3, 0xbd, 0x2d, 0xc7, 0x38, 0x9f, 0x13, 0x29, 0x92, 0x9f, 0x71, 0x53,
+    0xdd, 0x63, 0x5b, 0xd0, 0x4f, 0xd8, 0xbc, 0x67, 0x1d, 0xef, 0x0e, 0x39, 0x2e, 0x94, 0x69, 0x7a,
+    0xde, 0xff, 0x7c, 0xdc, 0xb1, 0x7b, 0xb1, 0xc2, 0xd3, 0x03, 0x7a, 0xba, 0xb6, 0x71, 0x5c, 0x6d,
+    0xa3, 0x61, 0x9a, 0x31, 0x0a, 0x7b, 0x3d, 0x0a, 0x7b, 0x37, 0x0a, 0x3b, 0x8f, 0xc2, 0x5e, 0x8f,
+    0x82, 0x87, 0x42, 0x37, 0x46, 0x70, 0x44, 0xb6, 0xc7, 0xc1, 0xb0, 0xfd, 0x97, 0xf2, 0x3f, 0x20,
+    0x81, 0x84, 0x48, 0xb6, 0x08, 0x00, 0x00,
+};
+
+#endif
@@ -2,31 +2,27 @@
 #define WEBPAGE_H
 #include <Arduino.h>
 #include "main.h"
-#include <WebServer.h>
 #include <WiFi.h>
+#include "HttpTask.h"
 
 #define ssid "ESP32WA8"
 #define password "12345678"
 
-extern WebServer server;
 extern int switch1, switch2, state1, state2;
 
-void setup_routes();
-void handle_root();
-void handle_state();
+// Commands from the page (see Webpage_poll)
 void handle_switch1_on();
 void handle_switch2_on();
 void handle_switch1_off();
 void handle_switch2_off();
-String createHTML();
 
 // Added web integration API
 void Webpage_init();
-void Webpage_poll();
+void Webpage_poll();                  // loop(): act on what the page asked for
+void Webpage_publish(uint32_t nowMs); // loop(): after Web_setState, hand the state to the http task
 bool Web_reqRaise();
 bool Web_reqLower();
 bool Web_reqAbort();
 void Web_setState(int s1,int s2);
 
 #endif
-
@@ -1,124 +1,71 @@
 #include "main.h"
-#include "Motor.h"
-#include "LimitSwitch.h"
+#include "InputEvents.h"
 #include "Ultrasonic.h"
+#include "SonicScheduler.h"
 #include "Config.h"
+#include "BoatTracker.h"
+#include "Hardware.h"
+#include "BridgeCore.h"
 
 // Dependencies
-static Motor*       Act=nullptr;
-static LimitSwitch* Limits=nullptr;
+static InputEvents* Inputs=nullptr;
 static Ultrasonic*  SonarWait=nullptr;
 static Ultrasonic*  SonarUnder=nullptr;
 static MainConfig   C;
 
-// env callbacks (from .ino)
-static VoidFn roadG, roadY, roadR, marineG, marineR, gatesUpFn, gatesDownFn;
-static BoolFn gatesDownOk, carOn, boatWait, boatUnder;
+// The two sonars take turns: SonarUnder only fires once SonarWait's ping has
+// landed and vice versa, so neither can hear the other's burst.
+enum { SONAR_WAIT, SONAR_UNDER, SONAR_COUNT };
+static Ultrasonic*  Sonars[SONAR_COUNT];
+static SonicScheduler<Ultrasonic, SONAR_COUNT> Pings(Sonars, Sonic_SlotUs(SONAR_MAX_MM, Sonic_GuardUs));
+static BoatTracker  Boats;
 
-// Finite State Machine based off Bridge State diagram! 
-enum State { DOWN, PREP_RAISE, RAISING, UP, PREP_LOW, LOWERING, EMERG_RAISE, EMERG_LOWER };
-static State S = DOWN;
-static uint32_t tEntry = 0;
+// The FSM, built against this target's hardware policy
+typedef BridgeCore<BridgeHw> Core;
 
-// per-motion contexts
-static bool raisingDecel=false, loweringDecel=false;
-
-void Main_init(Motor* m, LimitSwitch* ls, Ultrasonic* wait, Ultrasonic* under,
+void Main_init(InputEvents* in, Ultrasonic* wait, Ultrasonic* under,
                const MainConfig& cfg) {
-  Act=m; Limits=ls; SonarWait=wait; SonarUnder=under; C=cfg;
-  S = DOWN; tEntry = millis();
+  Inputs=in; SonarWait=wait; SonarUnder=under; C=cfg;
+  Sonars[SONAR_WAIT]=wait; Sonars[SONAR_UNDER]=under;
+  if (wait && under) Pings.init(SONAR_MIN_MM, SONAR_MAX_MM, SONAR_TOL_MM);   // benches run without
+  Core::init(cfg);
 }
 
-void Main_setEnvironment(VoidFn _roadG, VoidFn _roadY, VoidFn _roadR,
-                         VoidFn _marineG, VoidFn _marineR,
-                         VoidFn _gatesUp, VoidFn _gatesDown, BoolFn _gatesAreDown,
-                         BoolFn _carOn, BoolFn _boatWaiting, BoolFn _boatUnder) {
-  roadG=_roadG; roadY=_roadY; roadR=_roadR;
-  marineG=_marineG; marineR=_marineR;
-  gatesUpFn=_gatesUp; gatesDownFn=_gatesDown; gatesDownOk=_gatesAreDown;
-  carOn=_carOn; boatWait=_boatWaiting; boatUnder=_boatUnder;
+// Sample every input exactly once for this tick. The sonars are whatever
+// their filters hold; Pings fires the next one when its slot comes up.
+SensorFrame Main_sense(uint32_t tNow) {
+  Pings.service(micros());
+  SensorFrame f;
+  f.tMs     = tNow;
+  f.waitMM  = Pings.median(SONAR_WAIT);
+  f.underMM = Pings.median(SONAR_UNDER);
+  f.waitValid   = Pings.confidence(SONAR_WAIT)  >= SONAR_MIN_CONF;
+  f.boatWaiting = f.waitValid && f.waitMM < BOAT_WAITING_MM;
+  f.boatUnder   = Pings.confidence(SONAR_UNDER) >= SONAR_MIN_CONF && f.underMM < BOAT_UNDER_MM;
+  InputSnapshot in = Inputs->collect();
+  f.estop    = in.is(IN_ESTOP);
+  f.top      = in.is(IN_TOP);
+  f.bot      = in.is(IN_BOT);
+  f.btnRaise = in.is(IN_RAISE);
+  f.btnLower = in.is(IN_LOWER);
+  f.btnAbort = in.is(IN_ABORT);
+  f.edges    = in.edges;
+  f.edgeUs   = in.firstUs;
+  f.carOn = BridgeHw::carOnBridge();
+
+  // Start raising early enough that the span is up as the boat arrives.
+  Boats.update(f);
+  f.boatsTracked    = Boats.count();
+  f.boatApproaching = Boats.etaMs() <= C.T_YELLOW + C.T_OPEN_EXPECTED;
+  return f;
 }
 
-// small helpers
-static inline void gotoState(State ns, uint32_t tNow) { S=ns; tEntry=tNow; }
-
-void Main_tick(bool reqRaise, bool reqLower, bool reqAbort, uint32_t tNow) {
-
-  // realtime inputs
-  bool estop = Limits->eStop();
-  bool top   = Limits->topPressed();
-  bool bot   = Limits->bottomPressed();
-
-  switch (S) {
-
-    case DOWN: {
-      // outputs
-      roadG(); marineR(); gatesUpFn(); Act->stop();
-      if (reqRaise || boatWait()) gotoState(PREP_RAISE, tNow);
-    } break;
-
-    case PREP_RAISE: {
-      static bool primed=false;
-      if (!primed) { primed=true; tEntry=tNow; roadY(); marineR(); gatesDownFn(); }
-      if (carOn()) { primed=false; gotoState(EMERG_LOWER, tNow); break; }
-      if (tNow - tEntry >= C.T_YELLOW && gatesDownOk()) { primed=false; gotoState(RAISING, tNow); }
-    } break;
-
-    case RAISING: {
-      // on entry
-      if (tNow - tEntry == 0) {
-        raisingDecel=false; roadR(); marineR(); gatesDownFn();
-        Act->enable(); Act->dirUp(); Act->setSpeed(C.PWM_OPEN_CRUISE);
-      }
-      if (estop || reqAbort || carOn()) { Act->stop(); gotoState(EMERG_LOWER, tNow); break; }
-
-      uint32_t el = tNow - tEntry;
-      if (!raisingDecel && el >= C.T_OPEN_EXPECTED) { raisingDecel=true; Act->setSpeed(C.PWM_OPEN_SLOW); }
-      else { Act->setSpeed(raisingDecel ? C.PWM_OPEN_SLOW : C.PWM_OPEN_CRUISE); }
-
-      if (estop)                         { Act->stop(); gotoState(EMERG_LOWER, tNow); }
-      else if (top)                      { Act->stop(); gotoState(UP, tNow); }
-      else if (el >= C.T_OPEN_MAX)       { Act->stop(); gotoState(EMERG_LOWER, tNow); }
-    } break;
-
-    case UP: {
-      roadR(); marineG(); gatesDownFn(); Act->stop();
-      // If no boat is waiting or under the span, start PREP_LOW automatically
-      if (reqLower || (!boatWait() && !boatUnder())) gotoState(PREP_LOW, tNow);
-    } break;
-
-    case PREP_LOW: {
-      marineR(); // road remains red; gates remain down
-      if (boatUnder() || boatWait()) gotoState(UP, tNow);
-      else                           gotoState(LOWERING, tNow); // "All clear"
-    } break;
-
-    case LOWERING: {
-      if (tNow - tEntry == 0) {
-        loweringDecel=false; roadR(); marineR(); gatesDownFn();
-        Act->enable(); Act->dirDown(); Act->setSpeed(C.PWM_CLOSE_CRUISE);
-      }
-      if (estop || reqAbort || boatUnder()) { Act->stop(); gotoState(EMERG_RAISE, tNow); break; }
-
-      uint32_t el = tNow - tEntry;
-      if (!loweringDecel && el >= C.T_CLOSE_EXPECTED) { loweringDecel=true; Act->setSpeed(C.PWM_CLOSE_SLOW); }
-      else { Act->setSpeed(loweringDecel ? C.PWM_CLOSE_SLOW : C.PWM_CLOSE_CRUISE); }
-
-      if (bot)                       { Act->stop(); gotoState(DOWN, tNow); }
-      else if (el >= C.T_CLOSE_MAX)  { Act->stop(); gotoState(EMERG_RAISE, tNow); }
-    } break;
-
-    case EMERG_RAISE: {
-      roadR(); marineR(); gatesDownFn(); Act->enable(); Act->dirUp(); Act->setSpeed(C.PWM_OPEN_CRUISE);
-      if (top) { Act->stop(); gotoState(UP, tNow); }
-    } break;
+void Main_tick(const SensorFrame& f, bool reqRaise, bool reqLower, bool reqAbort) {
+  TickCtx c = { f, reqRaise, reqLower, reqAbort };
+  Core::tick(c);
 
-    case EMERG_LOWER: {
-      roadR(); marineR(); gatesDownFn(); Act->enable(); Act->dirDown(); Act->setSpeed(C.PWM_CLOSE_CRUISE);
-      if (bot) { Act->stop(); gotoState(DOWN, tNow); }
-    } break;
-  }
+  // The outputs for this frame are written; that is the reaction time.
+  if (f.edges) Inputs->noteReaction(f.edgeUs, micros());
 }
 
-typedef void (*VoidFn)();
-typedef bool (*BoolFn)();
+const InputLatency& Main_inputLatency() { return Inputs->latency(); }
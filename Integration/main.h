@@ -3,8 +3,8 @@
 #include "Config.h"
 
 // Forward declarations
-class Motor;
-class LimitSwitch;
+class InputEvents;
+struct InputLatency;
 class Ultrasonic;
 
 // Timings & speeds (tune later)
@@ -20,16 +20,36 @@ struct MainConfig {
   int PWM_CLOSE_SLOW   = 100;
 };
 
-// External effectors/sensors supplied by Integration.ino
-using VoidFn       = void (*)();
-using BoolFn       = bool (*)();
+// One consistent view of every input, captured once per tick by Main_sense()
+// and shared by every decision Main_tick makes.
+struct SensorFrame {
+  uint32_t tMs     = 0;
+  DistanceMM waitMM;        // SonarWait distance (filtered)
+  DistanceMM underMM;       // SonarUnder distance (filtered)
+  bool boatWaiting = false; // confident and waitMM  < BOAT_WAITING_MM
+  bool boatUnder   = false; // confident and underMM < BOAT_UNDER_MM
+  bool waitValid   = false; // SonarWait filter is confident
+  bool boatApproaching = false; // tracked boat will reach the waiting line within the raise lead time
+  uint8_t boatsTracked = 0; // boats between/at the sensors (BoatTracker)
+  bool top         = false; // limit switches / E-stop / buttons, debounced and
+  bool bot         = false; //   latched: true if held now or pressed since
+  bool estop       = false; //   the previous frame (see InputEvents.h)
+  bool btnRaise    = false;
+  bool btnLower    = false;
+  bool btnAbort    = false;
+  uint8_t  edges   = 0;     // input edges that arrived for this frame
+  uint32_t edgeUs  = 0;     // micros() of the oldest of them
+  bool carOn       = false;
+  int  photocell   = -1;    // raw ADC, -1 when not fitted
+};
 
-void Main_init(Motor* m, LimitSwitch* ls, Ultrasonic* wait, Ultrasonic* under,
+// Motor, lights, gates and the car sensor come from the hardware policy
+// (BridgeHw in Hardware.h); the inputs below are owned by Integration.ino.
+void Main_init(InputEvents* in, Ultrasonic* wait, Ultrasonic* under,
                const MainConfig& cfg = MainConfig());
 
-void Main_setEnvironment(VoidFn roadG, VoidFn roadY, VoidFn roadR,
-                         VoidFn marineG, VoidFn marineR,
-                         VoidFn gatesUp, VoidFn gatesDown, BoolFn gatesAreDown,
-                         BoolFn carOnBridge, BoolFn boatWaiting, BoolFn boatUnder);
+SensorFrame Main_sense(uint32_t tNow);
+void Main_tick(const SensorFrame& f, bool reqRaise, bool reqLower, bool reqAbort);
 
-void Main_tick(bool reqRaise, bool reqLower, bool reqAbort, uint32_t tNow);
+// Edge -> FSM reaction latency of the input layer.
+const InputLatency& Main_inputLatency();
@@ -0,0 +1,64 @@
+#include "GpioShadow.h"
+#ifdef ESP32
+#include "soc/gpio_reg.h"
+#endif
+
+GpioShadow outputs;
+
+GpioShadow::GpioShadow() {
+    for (uint8_t b = 0; b < 2; b++) {
+        want[b] = 0;
+        out[b] = 0;
+        owned[b] = 0;
+    }
+    stats = GpioStats();
+}
+
+// Makes the pin an output and writes its starting level straight away, so
+// the shadow and the pin agree from the first commit.
+void GpioShadow::attach(uint8_t pin, bool level) {
+    uint8_t b = pin >> 5;
+    uint32_t bit = 1UL << (pin & 31);
+    pinMode(pin, OUTPUT);
+    digitalWrite(pin, level);
+    owned[b] |= bit;
+    if (level) { want[b] |= bit; out[b] |= bit; }
+    else       { want[b] &= ~bit; out[b] &= ~bit; }
+}
+
+void GpioShadow::set(uint8_t pin, bool level) {
+    uint8_t b = pin >> 5;
+    uint32_t bit = 1UL << (pin & 31);
+    stats.sets++;
+    if (((want[b] & bit) != 0) == level) {
+        stats.elided++;
+        return;
+    }
+    want[b] ^= bit;
+}
+
+bool GpioShadow::get(uint8_t pin) const {
+    return (want[pin >> 5] >> (pin & 31)) & 1;
+}
+
+void GpioShadow::commit() {
+    bool wrote = false;
+    for (uint8_t b = 0; b < 2; b++) {
+        uint32_t diff = (want[b] ^ out[b]) & owned[b];
+        if (!diff) continue;
+        uint32_t high = diff & want[b];
+#ifdef ESP32
+        uint32_t low = diff & ~want[b];
+        if (high) REG_WRITE(b ? GPIO_OUT1_W1TS_REG : GPIO_OUT_W1TS_REG, high);
+        if (low)  REG_WRITE(b ? GPIO_OUT1_W1TC_REG : GPIO_OUT_W1TC_REG, low);
+#else
+        for (uint8_t i = 0; i < 32; i++) {
+            if (diff & (1UL << i)) digitalWrite(b * 32 + i, (high >> i) & 1);
+        }
+#endif
+        out[b] ^= diff;
+        for (uint32_t d = diff; d; d &= d - 1) stats.pinWrites++;
+        wrote = true;
+    }
+    if (wrote) stats.commits++;
+}
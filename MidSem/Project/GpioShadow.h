@@ -0,0 +1,40 @@
+#ifndef GPIOSHADOW_H
+#define GPIOSHADOW_H
+
+#include <Arduino.h>
+
+// Shadow register for the bridge's output pins. Anything that drives an
+// output calls set(), which only updates a bitmask; commit() then writes the
+// pins whose level actually changed. On the ESP32 that is at most one set
+// and one clear register write per bank (GPIO0-31, GPIO32-39) no matter how
+// many pins moved, so a blinking state that "writes" the same level every
+// pass costs nothing on the bus.
+//
+// Only pins registered with attach() are ever touched. Call commit() once at
+// the end of each pass.
+
+struct GpioStats {
+    uint32_t sets;          // set() calls
+    uint32_t elided;        // set() calls that asked for the level already pending
+    uint32_t commits;       // commit() calls that had something to write
+    uint32_t pinWrites;     // pin changes that reached the hardware
+};
+
+class GpioShadow {
+    private:
+        uint32_t want[2];       // level requested by set()
+        uint32_t out[2];        // level last written to the pins
+        uint32_t owned[2];      // pins registered with attach()
+        GpioStats stats;
+    public:
+        GpioShadow();
+        void attach(uint8_t pin, bool level = LOW);
+        void set(uint8_t pin, bool level);
+        bool get(uint8_t pin) const;
+        void commit();
+        const GpioStats& getStats() const { return stats; }
+};
+
+extern GpioShadow outputs;
+
+#endif
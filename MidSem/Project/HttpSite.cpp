@@ -0,0 +1,31 @@
+#include "HttpTask.h"
+
+const HttpRoute httpRoutes[] = {
+    { "/",                      Http_Page,      Http_NoCommand },
+    { "/state",                 Http_State,     Http_NoCommand },
+    { "/events",                Http_Events,    Http_NoCommand },
+    { "/metrics",               Http_Reply,     Web_Metrics },      // see LoopStats.h
+    { "/eStop",                 Http_Command,   Web_EStop },
+    { "/switchState",           Http_Command,   Web_SwitchState },
+    { "/activateBridge/raise",  Http_Command,   Web_Raise },
+    { "/activateBridge/lower",  Http_Command,   Web_Lower },
+};
+const uint8_t httpRouteCount = COUNT_OF(httpRoutes);
+
+// The page reads these names
+const JsonField httpStateSchema[] = {
+    JSON_FIELD("photoCellState",    Json_Flag,      ControlState, streetLight),
+    JSON_FIELD("sonicState",        Json_Flag,      ControlState, boat),
+    JSON_FIELD("sonic1Dist",        Json_Tenths,    ControlState, sonic1),
+    JSON_FIELD("sonic2Dist",        Json_Tenths,    ControlState, sonic2),
+    JSON_FIELD("trafficLightState", Json_U8,        ControlState, trafficLight),
+    JSON_FIELD("bridgeState",       Json_U8,        ControlState, state),
+    JSON_FIELD("gpioWrites",        Json_U32,       ControlState, gpioWrites),
+    JSON_FIELD("gpioElided",        Json_U32,       ControlState, gpioElided),
+    JSON_FIELD("nextState",         Json_Str,       ControlState, nextState),
+};
+const uint8_t httpStateFieldCount = JSON_COUNT(httpStateSchema);
+
+void httpSite_reply(JsonWriter& json, const WebReply& reply) {
+    reply.stats.json(json);
+}
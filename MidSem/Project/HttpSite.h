@@ -0,0 +1,47 @@
+#ifndef HTTPSITE_H
+#define HTTPSITE_H
+
+#include <Arduino.h>
+#include "Units.h"
+#include "StateMachine.h"
+#include "LoopStats.h"
+
+// What this sketch's web server serves (see HttpTask.h). The routes, the
+// /state schema and the /metrics body are in HttpSite.cpp.
+
+#define HttpSite_StateBytes     320     // /state as an event, see httpStateSchema
+#define HttpSite_ReplyBytes     LoopStats_JsonBytes
+
+enum WebCommandType : uint8_t {
+    Web_EStop,
+    Web_SwitchState,
+    Web_Raise,
+    Web_Lower,
+    Web_Metrics         // wants a reply
+};
+
+// Web_Metrics: loop()'s timings as they stood; the task writes the JSON
+struct WebReply {
+    uint16_t ticket;
+    LoopStats stats;
+};
+
+struct ControlState {
+    bridgeState state;
+    bool streetLight;
+    bool boat;
+    uint8_t trafficLight;
+    DistanceMM sonic1;
+    DistanceMM sonic2;
+    uint32_t gpioWrites;
+    uint32_t gpioElided;
+    const char* nextState;  // a string literal, so either side can read it
+};
+
+// What the page lights up for; a change in any of these goes out at once
+inline bool sameLights(const ControlState& a, const ControlState& b) {
+    return a.state == b.state && a.streetLight == b.streetLight
+        && a.boat == b.boat && a.trafficLight == b.trafficLight;
+}
+
+#endif
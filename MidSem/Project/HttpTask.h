@@ -0,0 +1,92 @@
+#ifndef HTTPTASK_H
+#define HTTPTASK_H
+
+#include <Arduino.h>
+#include "SpscRing.h"
+#include "JsonWriter.h"
+#include "HttpSite.h"
+
+// The web server runs in its own task, on core 0 with WiFi, so no client can
+// hold up loop(). It is one select() loop over non-blocking sockets: a client
+// that sends its request slowly or reads its response slowly only ever costs
+// a connection slot, never a wait.
+//
+// The task and loop() share nothing but three SPSC rings (see SpscRing.h):
+//   webCommands    task -> loop()   button presses, and requests for data only
+//                                   loop() has
+//   webReplies     loop() -> task   the answer to such a request, by value
+//   controlStates  loop() -> task   what the page shows, when it changes
+// /state and /events are answered from the newest ControlState the task has,
+// so they never wait for loop(). Each ring is drained in full every time;
+// a full ring refuses the push and the sender tries again next pass.
+//
+// Responses close the connection, except /events, which stays open as a
+// server-sent event stream: "event: state" with the /state JSON whenever
+// sameLights() says the page would change, and every HttpTask_HeartbeatMs
+// regardless. Other fields ride along in each message but don't trigger
+// one. A stream that falls a whole output buffer (HttpTask_OutBytes) behind
+// is dropped.
+//
+// Nothing here touches the heap: each connection has fixed request and
+// output buffers, the page goes straight from flash, and JSON is written
+// with JsonWriter. The /state JSON is rendered once per ControlState and
+// shared by every request and stream until the next one.
+//
+// This file and HttpTask.cpp are the same in every sketch. What a sketch
+// serves is in its HttpSite.h (ControlState, sameLights(), WebCommandType,
+// WebReply and their sizes), its HttpSite.cpp (the tables below) and its
+// WebPageHtml.h (the page).
+//
+// Off the board a std::thread stands in for the task and the sockets are
+// POSIX ones, so host/http_load can put it under load.
+
+#define HttpTask_Core               0
+#define HttpTask_StackBytes         6144
+#define HttpTask_Priority           1
+#define HttpTask_MaxConnections     8       // lwIP has 16 sockets in all
+#define HttpTask_MaxStreams         4       // of those, /events
+#define HttpTask_RequestBytes       1024    // request line and headers; more is a 431
+#define HttpTask_IdleMs             3000    // to send a whole request, or for loop() to answer it
+#define HttpTask_WaitMs             5       // select() timeout, so the most a state change waits to go out
+#define HttpTask_OutBytes           1024    // per connection: headers and a small body, or queued events
+#define HttpTask_HeartbeatMs        2000
+#define HttpTask_RetryMs            1000    // EventSource reconnect delay
+#define HttpTask_QueueSize          8
+#define HttpTask_ReplyQueueSize     2       // only one request waits on loop() at a time
+
+enum HttpAction : uint8_t {
+    Http_Page,          // the page, or a 304
+    Http_State,         // the newest ControlState as JSON
+    Http_Events,        // the same, as a server-sent event stream
+    Http_Command,       // queue the command for loop(), then send the page
+    Http_Reply          // queue the command with a ticket; loop() answers with a WebReply
+};
+
+struct HttpRoute {
+    const char* path;
+    HttpAction action;
+    WebCommandType command;     // Http_Command, Http_Reply; else Http_NoCommand
+};
+
+#define Http_NoCommand      ((WebCommandType)0)     // placeholder, never queued
+#define COUNT_OF(table)     (sizeof(table) / sizeof((table)[0]))
+
+struct WebCommand {
+    WebCommandType type;
+    uint16_t ticket;    // Http_Reply: hand back in the WebReply
+};
+
+extern SpscRing<WebCommand, HttpTask_QueueSize> webCommands;
+extern SpscRing<WebReply, HttpTask_ReplyQueueSize> webReplies;
+extern SpscRing<ControlState, HttpTask_QueueSize> controlStates;
+
+// From the sketch's HttpSite.cpp
+extern const HttpRoute httpRoutes[];
+extern const uint8_t httpRouteCount;
+extern const JsonField httpStateSchema[];       // /state, field by field
+extern const uint8_t httpStateFieldCount;
+void httpSite_reply(JsonWriter& json, const WebReply& reply);      // the body for an Http_Reply
+
+bool httpTask_init(uint16_t port);     // false if the port can't be listened on
+
+#endif
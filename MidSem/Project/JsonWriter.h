@@ -0,0 +1,176 @@
+#ifndef JSONWRITER_H
+#define JSONWRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Streaming JSON into a buffer the caller owns: no heap, no printf, nothing
+// on the stack bigger than an 11 byte digit scratch. Calls chain and the
+// commas look after themselves:
+//
+//     char buf[64];
+//     JsonWriter json(buf, sizeof(buf));
+//     json.beginObject().key("passes").u32(n).key("dist").fixed(mm, 1).endObject();
+//     respond(c, 200, "application/json", json.c_str(), json.length());
+//
+// respond() is in HttpTask.cpp; renderState() there does the same from a
+// schema (below).
+//
+// If the buffer runs out the writer stops there: ok() turns false and
+// c_str() is what fit, still terminated. Buffers are sized for the worst
+// case, so !ok() is a bug.
+//
+// fixed(v, d) writes v / 10^d with d decimals, so a value kept in tenths or
+// thousandths never has to become a float to be sent.
+//
+// A schema is a table of JsonField: a name, a type and where the value sits
+// in a struct (offsetof). object() writes one struct with it, so the shape
+// of an endpoint is a const table rather than a run of appends.
+
+enum JsonType : uint8_t {
+    Json_Flag,      // bool, as 1/0
+    Json_U8,        // uint8_t, or an enum : uint8_t
+    Json_U32,       // uint32_t
+    Json_Tenths,    // uint16_t in tenths, as 12.3 (a DistanceMM goes out in cm)
+    Json_Str        // const char*
+};
+
+struct JsonField {
+    const char* name;
+    JsonType type;
+    uint16_t offset;
+};
+
+#define JSON_FIELD(name, type, T, member)   { name, type, (uint16_t)offsetof(T, member) }
+#define JSON_COUNT(table)                   (sizeof(table) / sizeof((table)[0]))
+
+class JsonWriter {
+    private:
+        char* buf;
+        size_t cap;         // including the terminator
+        size_t len;
+        bool full;
+        bool comma;         // something came last at this level, so the next needs a ','
+
+        void put(char c) {
+            if (len + 1 < cap) {
+                buf[len++] = c;
+                buf[len] = '\0';
+            } else {
+                full = true;
+            }
+        }
+        void put(const char* s, size_t n) { while (n--) put(*s++); }
+        void separate() { if (comma) put(','); }
+
+    public:
+        JsonWriter(char* buffer, size_t size) : buf(buffer), cap(size), len(0), full(size == 0), comma(false) {
+            if (size) buf[0] = '\0';
+        }
+
+        // v in decimal into out (>= 11 bytes), terminated; returns the length
+        static uint8_t formatU32(char* out, uint32_t v) {
+            char tmp[10];
+            uint8_t n = 0, len = 0;
+            do { tmp[n++] = '0' + v % 10; v /= 10; } while (v);
+            while (n) out[len++] = tmp[--n];
+            out[len] = '\0';
+            return len;
+        }
+
+        JsonWriter& beginObject()   { separate(); put('{'); comma = false; return *this; }
+        JsonWriter& endObject()     { put('}'); comma = true; return *this; }
+        JsonWriter& beginArray()    { separate(); put('['); comma = false; return *this; }
+        JsonWriter& endArray()      { put(']'); comma = true; return *this; }
+
+        JsonWriter& key(const char* k) {
+            str(k);
+            put(':');
+            comma = false;
+            return *this;
+        }
+
+        JsonWriter& u32(uint32_t v) {
+            separate();
+            char d[11];
+            put(d, formatU32(d, v));
+            comma = true;
+            return *this;
+        }
+
+        JsonWriter& i32(int32_t v) {
+            if (v >= 0) return u32(v);
+            separate();
+            put('-');
+            comma = false;
+            return u32(0u - (uint32_t)v);
+        }
+
+        JsonWriter& fixed(int32_t v, uint8_t decimals) {
+            separate();
+            uint32_t m = v < 0 ? 0u - (uint32_t)v : (uint32_t)v;
+            if (v < 0) put('-');
+            char d[11];
+            uint8_t n = formatU32(d, m);
+            uint8_t digits = n > decimals ? n : decimals + 1;     // at least "0.x"
+            for (uint8_t i = 0; i < digits; i++) {
+                if (i == digits - decimals) put('.');
+                put(i < digits - n ? '0' : d[i - (digits - n)]);
+            }
+            comma = true;
+            return *this;
+        }
+
+        JsonWriter& flag(bool b) {
+            separate();
+            put(b ? '1' : '0');
+            comma = true;
+            return *this;
+        }
+
+        JsonWriter& str(const char* s) {
+            static const char hex[] = "0123456789abcdef";
+            separate();
+            put('"');
+            for (; s && *s; s++) {
+                char c = *s;
+                if (c == '"' || c == '\\') {
+                    put('\\');
+                    put(c);
+                } else if ((uint8_t)c < 0x20) {
+                    put("\\u00", 4);
+                    put(hex[(uint8_t)c >> 4]);
+                    put(hex[c & 0xf]);
+                } else {
+                    put(c);
+                }
+            }
+            put('"');
+            comma = true;
+            return *this;
+        }
+
+        // Every field of *obj, as described by the table
+        JsonWriter& object(const JsonField* fields, uint8_t count, const void* obj) {
+            const uint8_t* base = (const uint8_t*)obj;
+            beginObject();
+            for (uint8_t i = 0; i < count; i++) {
+                const void* p = base + fields[i].offset;
+                key(fields[i].name);
+                switch (fields[i].type) {
+                    case Json_Flag:     flag(*(const bool*)p);                  break;
+                    case Json_U8:       u32(*(const uint8_t*)p);                break;
+                    case Json_U32:      u32(*(const uint32_t*)p);               break;
+                    case Json_Tenths:   fixed(*(const uint16_t*)p, 1);          break;
+                    case Json_Str:      str(*(const char* const*)p);            break;
+                }
+            }
+            return endObject();
+        }
+
+        const char* c_str() const { return buf; }
+        size_t length() const { return len; }
+        bool ok() const { return !full; }
+};
+
+#endif
@@ -0,0 +1,123 @@
+#include "LoopStats.h"
+
+LoopStats loopStats;
+
+static const char* const phaseNames[Phase_Count] = { "web", "sonics", "stateMachine", "streetLights", "commit", "push" };
+
+static void clearStats(PhaseStats& s) {
+    memset(&s, 0, sizeof(s));
+    s.minCycles = UINT32_MAX;
+}
+
+LoopStats::LoopStats() {
+    cyclesPerUs = 1;
+    reset();
+}
+
+void LoopStats::begin() {
+#ifdef ESP32
+    cyclesPerUs = getCpuFrequencyMhz();
+#endif
+    reset();
+}
+
+void LoopStats::reset() {
+    for (uint8_t p = 0; p < Phase_Count; p++) {
+        clearStats(phase[p]);
+        current[p] = 0;
+        worst[p] = 0;
+    }
+    clearStats(pass);
+    worstAtMs = 0;
+    passBegin = lastMark = cycles();
+}
+
+void LoopStats::passEnd() {
+    uint32_t total = lastMark - passBegin;
+    if (total > pass.maxCycles) {
+        memcpy(worst, current, sizeof(worst));
+        worstAtMs = millis();
+    }
+    record(pass, total);
+}
+
+uint32_t LoopStats::p99(const PhaseStats& s) {
+    if (!s.count) return 0;
+    uint32_t target = s.count - s.count / 100;     // passes at or below p99
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < LoopStats_Buckets; i++) {
+        seen += s.hist[i];
+        if (seen >= target) {
+            uint32_t top = i == 31 ? UINT32_MAX : (2UL << i) - 1;
+            return top < s.maxCycles ? top : s.maxCycles;
+        }
+    }
+    return s.maxCycles;
+}
+
+void LoopStats::jsonPhase(JsonWriter& json, const char* name, const PhaseStats& s) const {
+    json.key(name).beginObject();
+    json.key("count").u32(s.count);
+    json.key("minNs").u32(s.count ? toNs(s.minCycles) : 0);
+    json.key("avgNs").u32(avgNs(s));
+    json.key("p99Ns").u32(toNs(p99(s)));
+    json.key("maxNs").u32(toNs(s.maxCycles));
+    json.key("hist").beginArray();
+    int8_t last = LoopStats_Buckets - 1;
+    while (last >= 0 && !s.hist[last]) last--;
+    for (int8_t i = 0; i <= last; i++) json.u32(s.hist[i]);
+    json.endArray();
+    json.endObject();
+}
+
+// hist[i] counts runs of a phase that took [2^i, 2^(i+1)) cycles;
+// divide by cpuMhz for microseconds
+void LoopStats::json(JsonWriter& json) const {
+    json.beginObject();
+    json.key("cpuMhz").u32(cyclesPerUs);
+    json.key("passes").u32(pass.count);
+    json.key("jitterNs").u32(pass.count ? toNs(pass.maxCycles - pass.minCycles) : 0);
+    json.key("phases").beginObject();
+    for (uint8_t p = 0; p < Phase_Count; p++) jsonPhase(json, phaseNames[p], phase[p]);
+    jsonPhase(json, "pass", pass);
+    json.endObject();
+    json.key("worst").beginObject();
+    json.key("atMs").u32(worstAtMs);
+    for (uint8_t p = 0; p < Phase_Count; p++) {
+        char name[24];
+        strcpy(name, phaseNames[p]);
+        strcat(name, "Ns");
+        json.key(name).u32(toNs(worst[p]));
+    }
+    json.endObject();
+    json.endObject();
+}
+
+void LoopStats::printRow(const char* name, const PhaseStats& s) const {
+    char line[96];
+    snprintf(line, sizeof(line), "%-13s %9lu %9lu %9lu %9lu %9lu",
+             name, (unsigned long)s.count,
+             (unsigned long)(s.count ? toNs(s.minCycles) : 0),
+             (unsigned long)avgNs(s),
+             (unsigned long)toNs(p99(s)),
+             (unsigned long)toNs(s.maxCycles));
+    Serial.println(line);
+}
+
+void LoopStats::print() const {
+    Serial.println(F("phase             count    min ns    avg ns    p99 ns    max ns"));
+    for (uint8_t p = 0; p < Phase_Count; p++) printRow(phaseNames[p], phase[p]);
+    printRow("pass", pass);
+    Serial.print(F("jitter ns: "));
+    Serial.println((unsigned long)(pass.count ? toNs(pass.maxCycles - pass.minCycles) : 0));
+    Serial.print(F("worst pass at ms "));
+    Serial.print((unsigned long)worstAtMs);
+    Serial.print(F(":"));
+    for (uint8_t p = 0; p < Phase_Count; p++) {
+        Serial.print(F(" "));
+        Serial.print(phaseNames[p]);
+        Serial.print(F("="));
+        Serial.print((unsigned long)toNs(worst[p]));
+    }
+    Serial.println();
+}
@@ -0,0 +1,97 @@
+#ifndef LOOPSTATS_H
+#define LOOPSTATS_H
+
+#include <Arduino.h>
+#include "JsonWriter.h"
+
+// Where loop() spends its time. A pass is bracketed by passStart() and
+// passEnd(), and mark(phase) after each phase charges the time since the
+// previous mark to it. Times are CPU cycles from the core's cycle counter
+// (ESP.getCycleCount(), ~4ns at 240MHz); off the board micros() stands in.
+//
+// Each phase keeps a log2 histogram: bucket i counts passes that took
+// [2^i, 2^(i+1)) cycles, so 32 buckets hold any uint32 and p99 reads back as
+// the top of the bucket the 99th percentile falls in (within 2x, never above
+// the real max). Recording is a counter read, a subtraction, a clz and a few
+// adds, tens of cycles.
+//
+// The slowest pass is kept whole, every phase and when it happened, so a
+// spike can be put down to the phase that caused it. Jitter is the spread
+// between the fastest and slowest pass.
+
+#define LoopStats_Buckets   32
+#define LoopStats_JsonBytes 3584    // json() at its longest: every count ten digits, every bucket used
+
+enum LoopPhase : uint8_t {
+    Phase_Web,
+    Phase_Sonics,
+    Phase_State,
+    Phase_Street,
+    Phase_Commit,
+    Phase_Push,
+    Phase_Count
+};
+
+struct PhaseStats {
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t sumCycles;
+    uint32_t hist[LoopStats_Buckets];
+};
+
+class LoopStats {
+    private:
+        PhaseStats phase[Phase_Count];
+        PhaseStats pass;                    // whole passes
+        uint32_t passBegin;
+        uint32_t lastMark;
+        uint32_t current[Phase_Count];      // this pass, so far
+        uint32_t worst[Phase_Count];        // the slowest pass, split by phase
+        uint32_t worstAtMs;
+        uint32_t cyclesPerUs;
+
+        static void record(PhaseStats& s, uint32_t cycles) {
+            s.count++;
+            s.sumCycles += cycles;
+            if (cycles < s.minCycles) s.minCycles = cycles;
+            if (cycles > s.maxCycles) s.maxCycles = cycles;
+            s.hist[31 - __builtin_clz(cycles | 1)]++;
+        }
+        static uint32_t p99(const PhaseStats& s);
+        uint32_t toNs(uint32_t cycles) const {
+            uint64_t ns = (uint64_t)cycles * 1000 / cyclesPerUs;
+            return ns > UINT32_MAX ? UINT32_MAX : ns;
+        }
+        uint32_t avgNs(const PhaseStats& s) const { return s.count ? s.sumCycles * 1000 / cyclesPerUs / s.count : 0; }
+        void jsonPhase(JsonWriter& json, const char* name, const PhaseStats& s) const;
+        void printRow(const char* name, const PhaseStats& s) const;
+    public:
+        static uint32_t cycles() {
+#ifdef ESP32
+            return ESP.getCycleCount();
+#else
+            return micros();
+#endif
+        }
+
+        LoopStats();
+        void begin();
+        void reset();
+
+        void passStart() { passBegin = lastMark = cycles(); }
+        void mark(LoopPhase p) {
+            uint32_t now = cycles();
+            current[p] = now - lastMark;
+            record(phase[p], current[p]);
+            lastMark = now;
+        }
+        void passEnd();
+
+        void json(JsonWriter& json) const;  // for /metrics
+        void print() const;     // for the serial "stats" command
+};
+
+extern LoopStats loopStats;
+
+#endif
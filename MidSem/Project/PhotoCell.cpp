@@ -0,0 +1,43 @@
+#include "PhotoCell.h"
+
+PhotoCell::PhotoCell(uint8_t pin, uint16_t sampleMs) : cachedLevel(0), cachedDark(false) {
+    this->pin = pin;
+    this->sampleMs = sampleMs;
+    lastSample = 0;
+    ema = 0;
+    primed = false;
+}
+
+void PhotoCell::init() {
+    pinMode(pin, INPUT);
+}
+
+void PhotoCell::service(uint32_t nowMs) {
+    if (primed && nowMs - lastSample < sampleMs) return;
+    lastSample = nowMs;
+
+    uint32_t raw = analogRead(pin);
+    if (!primed) {
+        // Start the average at the first reading instead of ramping up from 0,
+        // which would switch the lights on for the first second after boot.
+        ema = raw << PhotoCell_EmaShift;
+        primed = true;
+    } else {
+        ema = ema - (ema >> PhotoCell_EmaShift) + raw;
+    }
+    uint16_t avg = (uint16_t)(ema >> PhotoCell_EmaShift);
+    cachedLevel.store(avg, std::memory_order_relaxed);
+
+    bool isDark = cachedDark.load(std::memory_order_relaxed);
+    if (isDark && avg > PhotoCell_LightAbove) isDark = false;
+    else if (!isDark && avg < PhotoCell_DarkBelow) isDark = true;
+    cachedDark.store(isDark, std::memory_order_relaxed);
+}
+
+uint16_t PhotoCell::level() const {
+    return cachedLevel.load(std::memory_order_relaxed);
+}
+
+bool PhotoCell::dark() const {
+    return cachedDark.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,34 @@
+#ifndef PHOTOCELL_H
+#define PHOTOCELL_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Background light-level service for the street light photocell.
+// service() is called from the sensor task and takes one analogRead() every
+// PhotoCell_SampleMs; the readings go through an integer EMA and a hysteresis
+// band. loop() only reads the cached results, so street lighting is O(1) there.
+
+#define PhotoCell_SampleMs      50      // one ADC read per 50ms
+#define PhotoCell_EmaShift      3       // alpha = 1/8, ~0.4s time constant at 50ms
+#define PhotoCell_DarkBelow     1250    // lights on once the average drops under this
+#define PhotoCell_LightAbove    1350    // ...and off again once it climbs over this
+
+class PhotoCell {
+    private:
+        uint8_t pin;
+        uint16_t sampleMs;
+        uint32_t lastSample;
+        uint32_t ema;                   // average << PhotoCell_EmaShift
+        bool primed;
+        std::atomic<uint16_t> cachedLevel;
+        std::atomic<bool> cachedDark;
+    public:
+        PhotoCell(uint8_t pin, uint16_t sampleMs = PhotoCell_SampleMs);
+        void init();
+        void service(uint32_t nowMs);   // producer side (sensor task)
+        uint16_t level() const;         // smoothed raw ADC counts
+        bool dark() const;              // true = street light should be on
+};
+
+#endif
@@ -0,0 +1,90 @@
+#include "SensorTask.h"
+#include "main.h"
+
+#ifndef ESP32
+#include <thread>
+#include <chrono>
+#endif
+
+SpscRing<SensorSample, SensorTask_RingSize> sensorRing;
+
+// Every sonic on the bridge, in firing order. Adding a sensor (e.g. a second
+// waiting zone) is one more entry here.
+static Sonic* const sonicSensors[] = { &sonic1, &sonic2 };
+
+static SonicScheduler<Sonic, sizeof(sonicSensors) / sizeof(sonicSensors[0])>
+    scheduler(sonicSensors, Sonic_SlotUs(Sonic_MaxRange, Sonic_GuardUs));
+
+// Time between full sensing rounds for each bridgeState (index = state).
+// 0 runs the rounds back to back: used while the span is moving or we are
+// checking it is clear. Idle states sample slowly to leave CPU and airtime
+// for the web server.
+static const uint16_t sonicRoundMs[] = {
+    0,      // (unused)
+    250,    // lowered        - idle, just watching for boats
+    100,    // prepareRaise
+    0,      // raising
+    100,    // raised
+    0,      // prepareLower   - clearance check
+    0,      // lowering       - boat under the span is safety critical
+    0,      // emergencyLower
+    0,      // emergencyRaise
+};
+
+static uint32_t sonicRoundUs(bridgeState state) {
+    uint8_t i = (uint8_t)state;
+    return i < sizeof(sonicRoundMs) / sizeof(sonicRoundMs[0]) ? sonicRoundMs[i] * 1000UL : 0;
+}
+
+static void sensorSleepMs(uint32_t ms) {
+#ifdef ESP32
+    vTaskDelay(pdMS_TO_TICKS(ms));
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#endif
+}
+
+// Producer: the scheduler fires one sensor per slot; every time a slot
+// closes the filtered distances are published. The photocell rides along
+// at its own (much lower) rate. Sleeping here is fine, it
+// only ever holds up this task.
+static void sensorTask(void*) {
+    for (;;) {
+        scheduler.setRoundPeriod(sonicRoundUs(currentState));
+        if (scheduler.service(micros()) >= 0) {
+            SensorSample s;
+            s.timeMs = millis();
+            s.count = scheduler.count();
+            for (uint8_t i = 0; i < s.count; i++) {
+                s.sonic[i] = scheduler.median(i);
+                s.confidence[i] = scheduler.confidence(i);
+            }
+            sensorRing.push(s);
+        }
+        photoCell.service(millis());
+        uint32_t sleepMs = (scheduler.usUntilNextSlot(micros()) + 999) / 1000;
+        sensorSleepMs(sleepMs < SensorTask_MaxSleepMs ? sleepMs : SensorTask_MaxSleepMs);
+    }
+}
+
+void sensorTask_init() {
+    scheduler.init(Sonic_MinRange, Sonic_MaxRange, Sonic_Tolerance);
+#ifdef ESP32
+    xTaskCreatePinnedToCore(sensorTask, "sensors", SensorTask_StackBytes, NULL,
+                            SensorTask_Priority, NULL, SensorTask_Core);
+#else
+    std::thread(sensorTask, nullptr).detach();   // host build: a thread stands in for the task
+#endif
+}
+
+// Consumer: empty the ring, keep the newest sample. Returns false if nothing
+// new arrived since the last call.
+bool sensorTask_drain(SensorSample& latest) {
+    bool fresh = false;
+    SensorSample s;
+    while (sensorRing.pop(s)) {
+        latest = s;
+        fresh = true;
+    }
+    return fresh;
+}
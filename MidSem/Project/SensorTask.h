@@ -0,0 +1,30 @@
+#ifndef SENSORTASK_H
+#define SENSORTASK_H
+
+#include <Arduino.h>
+#include "SpscRing.h"
+#include "SonicScheduler.h"
+
+// Sensor acquisition runs in its own task on the core loop() isn't using
+// (core 0 on the ESP32; loop() lives on core 1). Samples are handed to the
+// state machine through a lock-free SPSC ring that loop() drains each pass.
+
+#define SensorTask_Core         0
+#define SensorTask_StackBytes   4096
+#define SensorTask_Priority     1
+#define SensorTask_RingSize     16
+#define SensorTask_MaxSleepMs   10      // so a bridgeState change re-rates sensing quickly
+
+struct SensorSample {
+    uint32_t timeMs;
+    uint8_t count;                          // sensors in use (see sonicSensors[])
+    DistanceMM sonic[Sonic_MaxSensors];     // filtered (median) distances
+    uint8_t confidence[Sonic_MaxSensors];   // 0..100, see DistanceFilter
+};
+
+extern SpscRing<SensorSample, SensorTask_RingSize> sensorRing;
+
+void sensorTask_init();
+bool sensorTask_drain(SensorSample& latest);
+
+#endif
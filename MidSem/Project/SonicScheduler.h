@@ -0,0 +1,118 @@
+#ifndef SONICSCHEDULER_H
+#define SONICSCHEDULER_H
+
+#include <Arduino.h>
+#include "Units.h"
+#include "DistanceFilter.h"
+
+// Filter stage applied to every echo
+#define Sonic_FilterWindow      5       // median of the last 5 good echoes
+#define Sonic_MinRange          20_mm   // HC-SR04 blind zone
+#define Sonic_MaxRange          4000_mm
+#define Sonic_Tolerance         50_mm   // echoes this close to the median "agree"
+#define Sonic_MinConfidence     60      // below this a sensor's reading is ignored
+#define Sonic_GuardUs           2000    // extra quiet time after the max-range echo
+#define Sonic_MaxSensors        4
+#define Sonic_BusyPollUs        1000    // re-check a sensor still listening past its slot
+
+// Minimum time-slot length for one ping: the round trip to the furthest
+// distance we accept plus a guard for ringing and multipath. The HC-SR04
+// listens longer than that (up to ~38ms with no echo), so a slot also stays
+// open until its sensor's echo line has dropped; only then does the next one
+// fire. Only one sensor is ever in flight, so an echo can only be heard by
+// the sensor that sent it.
+#define Sonic_SlotUs(maxRange, guardUs) ((maxRange).echoTime().us() + (guardUs))
+
+// Round-robin ultrasonic scheduler over a compile-time array of N sensors.
+// Slot k fires sensor k; when the slot closes its echo is run through that
+// sensor's DistanceFilter and the next sensor fires. A slot closes once it is
+// slotUs old and the sensor is no longer busy() (EchoCapture gives up on a
+// ping that never ends), so near targets keep the short slot and a far or
+// missing echo just stretches that one. Each sensor is sampled every N slots.
+// setRoundPeriod() can stretch the time between full rounds (e.g. while the
+// bridge is idle); it never shortens a slot.
+//
+// Sensor is any echo source with init(), trigger(), busy() and
+// readEcho(DistanceMM&) returning each finished echo once (Sonic here).
+template <class Sensor, uint8_t N>
+class SonicScheduler {
+    static_assert(N >= 1 && N <= Sonic_MaxSensors, "SonicScheduler supports 1..Sonic_MaxSensors sensors");
+    private:
+        Sensor* const* sensors;
+        DistanceFilter<Sonic_FilterWindow> filters[N];
+        uint32_t slotUs;
+        uint32_t slotStart;
+        uint32_t roundUs;       // minimum time between the starts of two rounds
+        uint32_t roundStart;
+        uint8_t current;
+        bool running;
+        bool idle;              // round finished, waiting out roundUs
+        bool listening;         // slot time is up but its sensor is still busy
+    public:
+        SonicScheduler(Sensor* const (&list)[N], uint32_t slot) {
+            sensors = list;
+            slotUs = slot;
+            slotStart = 0;
+            roundUs = 0;
+            roundStart = 0;
+            current = 0;
+            running = false;
+            idle = false;
+            listening = false;
+        }
+
+        void init(DistanceMM minRange, DistanceMM maxRange, DistanceMM tolerance) {
+            for (uint8_t i = 0; i < N; i++) {
+                sensors[i]->init();
+                filters[i].setRange(minRange, maxRange);
+                filters[i].setTolerance(tolerance);
+            }
+        }
+
+        // Call as often as convenient. Returns the index of the sensor whose
+        // slot just closed (its filter now holds the new echo), or -1.
+        int service(uint32_t nowUs) {
+            if (!running || (idle && nowUs - roundStart >= roundUs)) {
+                running = true;
+                idle = false;
+                current = 0;
+                roundStart = nowUs;
+                slotStart = nowUs;
+                sensors[0]->trigger();
+                return -1;
+            }
+            if (idle || nowUs - slotStart < slotUs) return -1;
+            listening = sensors[current]->busy();
+            if (listening) return -1;
+
+            int done = current;
+            DistanceMM echo;
+            if (sensors[done]->readEcho(echo)) filters[done].push(echo);
+
+            current = (current + 1) % N;
+            slotStart = nowUs;
+            if (current == 0 && nowUs - roundStart < roundUs) {
+                idle = true;
+            } else {
+                if (current == 0) roundStart = nowUs;
+                sensors[current]->trigger();
+            }
+            return done;
+        }
+
+        uint32_t usUntilNextSlot(uint32_t nowUs) const {
+            if (listening) return Sonic_BusyPollUs;
+            uint32_t el = nowUs - (idle ? roundStart : slotStart);
+            uint32_t len = idle ? roundUs : slotUs;
+            return el >= len ? 0 : len - el;
+        }
+
+        // 0 = back-to-back rounds (the physical maximum rate).
+        void setRoundPeriod(uint32_t us) { roundUs = us; }
+
+        static uint8_t count() { return N; }
+        DistanceMM median(uint8_t i) const { return filters[i].median(); }
+        uint8_t confidence(uint8_t i) const { return filters[i].confidence(); }
+};
+
+#endif
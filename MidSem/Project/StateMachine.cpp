@@ -4,24 +4,38 @@
 #include "TrafficLight.h"
 #include "SonicSensor.h"
 #include "DCMotor.h"
+#include "Fsm.h"
+#include "TimerService.h"
 
 
-// Timers
-unsigned long startTime = 0;
+// Timer lengths
 const unsigned long lowerDelay = 8000; // wait before next action
 const unsigned long yellowDelay = 12000;
 const unsigned long raiseDelay = 3000;
-const int boatcount_required = 4;
+const unsigned long raisedHold = 8000; // time up before lowering again
+const unsigned long emergencyDwell = 500; // motor off before reversing
+const unsigned long emergencyTimeout = 15000; // give up if the limit never closes
 
 const int seabed_distance = 20;
-int boatDetection_count = 0;
 extern bool EStop;
 bool status_on = false;
 
-unsigned long blinkDelayStart = 0;
 const unsigned long blinkDelayDuration = 550;
 bool blinkState = false;
 
+// Every timer the bridge uses. Each state arms its own on entry and
+// cancels it on exit, so nothing is shared or reset by hand.
+enum BridgeTimer : uint8_t {
+  Timer_PrepRaise,
+  Timer_RaisedHold,
+  Timer_PrepLower,
+  Timer_Blink,
+  Timer_EmergencyDwell,
+  Timer_EmergencyTimeout,
+  Timer_Count
+};
+static TimerService<Timer_Count> timers;
+
 
 
 
@@ -29,21 +43,206 @@ bool blinkState = false;
 
 
 // Helper functions
-void flash(int pin)    { digitalWrite(pin, blinkState); }
-void blink()           { if ((millis() - blinkDelayStart) >= blinkDelayDuration) { blinkDelayStart = millis(); blinkState=!blinkState; } }
+void flash(int pin)    { outputs.set(pin, blinkState); }
+void blink(uint32_t now) { bool due = timers.take(Timer_Blink); if (due) blinkState = !blinkState; if (due || !timers.armed(Timer_Blink)) timers.start(Timer_Blink, now, blinkDelayDuration); }
 void bottomInterrupt() { detachInterrupt(digitalPinToInterrupt(Pin_LS_Top));     attachInterrupt(digitalPinToInterrupt(Pin_LS_Bottom), disableMotor, FALLING);}
 void topInterrupt()    { detachInterrupt(digitalPinToInterrupt(Pin_LS_Bottom));  attachInterrupt(digitalPinToInterrupt(Pin_LS_Top), disableMotor, FALLING);}
 bool eStopPressed()    { bool temp = !digitalRead(Pin_EStop); return temp;}
 bool topLimitHit()     { bool temp = !digitalRead(Pin_LS_Top); return temp;}
 bool bottomLimitHit()  { bool temp = !digitalRead(Pin_LS_Bottom);  return temp;}
-bool boatDetected()    { return ultrasonics; }  // boat nearby
-bool timerFinished(long delay)   { /*Serial.println(millis());*/ /*Serial.println(startTime);*/ return (millis() - startTime) > delay; }
-bool timerUp()         { return millis() - startTime > 8000;}
+bool boatDetected()    { return ultrasonics; }  // boat nearby (already median filtered)
 void startMotorUp()    { motor.run(64, 1); Serial.println("Motor UP started."); }
 void startMotorDown()  { motor.run(64, 0); Serial.println("Motor DOWN started."); }
 void stopMotor()       { motor.disable(); Serial.println("Motor stopped."); }
 
 
+// Inputs sampled once per pass and handed to every state handler
+struct BridgeInputs {
+  uint32_t nowMs;
+  bool boat;
+  bool topLimit;
+  bool bottomLimit;
+};
+
+// State handlers. Outputs that hold for the whole state are set once in
+// enter; tick only does what has to happen every pass (blinking). Both go
+// through the output shadow, so nothing reaches a pin until loop() commits.
+static void loweredEnter(BridgeInputs&) {
+  outputs.set(Pin_Status, LOW);
+  outputs.set(Pin_Buzzer, LOW);
+  outputs.set(Pin_BoatLight, HIGH);
+  traffic.cycle(2); //2 = Green
+}
+static bridgeState loweredTick(BridgeInputs& in, uint32_t) {
+  if (in.boat) {
+    Serial.println("Boat detected → PREPARE TO RAISE");
+    return prepareRaise;
+  }
+  return lowered;
+}
+
+static void prepareRaiseEnter(BridgeInputs& in) {
+  Serial.println("STATE: PREP TO RAISE — waiting before lifting");
+  timers.start(Timer_PrepRaise, in.nowMs, yellowDelay);
+  outputs.set(Pin_BoatLight, HIGH);
+  traffic.cycle(1);
+}
+static bridgeState prepareRaiseTick(BridgeInputs& in, uint32_t) {
+  blink(in.nowMs);
+  flash(Pin_Buzzer);
+  flash(Pin_Status);
+  if (timers.take(Timer_PrepRaise)) {
+    Serial.println("Prep timer done → RAISING");
+    return raising;
+  }
+  return prepareRaise;
+}
+static void prepareRaiseExit(BridgeInputs&) { timers.cancel(Timer_PrepRaise); }
+
+static void raisingEnter(BridgeInputs&) {
+  topInterrupt();
+  startMotorUp();
+  outputs.set(Pin_BoatLight, HIGH);
+  outputs.set(Pin_Status, HIGH);
+  traffic.cycle(0);
+}
+static bridgeState raisingTick(BridgeInputs& in, uint32_t) {
+  blink(in.nowMs);
+  flash(Pin_Buzzer);
+  if (in.topLimit) return raised;
+  return raising;
+}
+// However the state is left (limit switch or the web page), the motor stops here
+static void raisingExit(BridgeInputs&) { stopMotor(); }
+
+static void raisedEnter(BridgeInputs& in) {
+  Serial.println("STATE: UP (bridge up for boats)");
+  timers.start(Timer_RaisedHold, in.nowMs, raisedHold);
+  outputs.set(Pin_Status, LOW);
+  outputs.set(Pin_Buzzer, LOW);
+  outputs.set(Pin_BoatLight, LOW);
+  traffic.cycle(0);
+}
+static bridgeState raisedTick(BridgeInputs&, uint32_t) {
+  return timers.take(Timer_RaisedHold) ? prepareLower : raised;
+}
+static void raisedExit(BridgeInputs&) { timers.cancel(Timer_RaisedHold); }
+
+static void prepareLowerEnter(BridgeInputs& in) {
+  Serial.println("STATE: PREP TO LOWER");
+  timers.start(Timer_PrepLower, in.nowMs, lowerDelay);
+  outputs.set(Pin_Status, HIGH);
+  traffic.cycle(0);
+}
+static bridgeState prepareLowerTick(BridgeInputs& in, uint32_t) {
+  blink(in.nowMs);
+  flash(Pin_Buzzer); 
+  flash(Pin_BoatLight);
+  return timers.take(Timer_PrepLower) ? lowering : prepareLower;
+}
+static void prepareLowerExit(BridgeInputs&) { timers.cancel(Timer_PrepLower); }
+
+static void loweringEnter(BridgeInputs&) {
+  Serial.println("STATE: LOWERING");
+  bottomInterrupt();
+  startMotorDown();
+  outputs.set(Pin_BoatLight, HIGH);
+  outputs.set(Pin_Status, HIGH);
+}
+static bridgeState loweringTick(BridgeInputs& in, uint32_t) {
+  blink(in.nowMs);
+  flash(Pin_Buzzer); 
+  if (in.bottomLimit) {
+    Serial.println("Bridge fully lowered → DOWN");
+    return lowered;
+  }
+  return lowering;
+}
+static void loweringExit(BridgeInputs&) { stopMotor(); }
+
+// Emergency raise/lower. A step machine inside the state instead of a
+// blocking delay, so the web page and sensors keep running; it finishes when
+// the limit switch closes.
+//   Stop   motor off, wait emergencyDwell before reversing
+//   Drive  motor on toward the limit (the limit ISR also cuts it)
+//   Fault  emergencyTimeout ran out first; motor off until the switch
+//          closes or a state is picked from the web page
+enum EmergencyStep : uint8_t { Emergency_Stop, Emergency_Drive, Emergency_Fault };
+static EmergencyStep emergencyStep = Emergency_Stop;
+
+static void emergencyEnter(BridgeInputs& in) {
+  stopMotor();
+  emergencyStep = Emergency_Stop;
+  timers.start(Timer_EmergencyDwell, in.nowMs, emergencyDwell);
+  outputs.set(Pin_Status, HIGH);
+  outputs.set(Pin_BoatLight, HIGH);
+  traffic.cycle(0);
+}
+
+static bridgeState emergencyTick(BridgeInputs& in, bool up, bridgeState self, bridgeState done) {
+  blink(in.nowMs);
+  flash(Pin_Buzzer);
+  if (up ? in.topLimit : in.bottomLimit) {
+    if (emergencyStep == Emergency_Drive) stopMotor();
+    Serial.println(up ? "Emergency raise complete → UP" : "Emergency lower complete → DOWN");
+    return done;
+  }
+  switch (emergencyStep) {
+    case Emergency_Stop:
+      if (timers.take(Timer_EmergencyDwell)) {
+        if (up) { topInterrupt(); startMotorUp(); }
+        else    { bottomInterrupt(); startMotorDown(); }
+        timers.start(Timer_EmergencyTimeout, in.nowMs, emergencyTimeout);
+        emergencyStep = Emergency_Drive;
+      }
+      break;
+    case Emergency_Drive:
+      if (timers.take(Timer_EmergencyTimeout)) {
+        stopMotor();
+        Serial.println("EMERGENCY: limit switch not reached, motor stopped");
+        emergencyStep = Emergency_Fault;
+      }
+      break;
+    case Emergency_Fault:
+      break;
+  }
+  return self;
+}
+
+static void emergencyExit(BridgeInputs&) {
+  timers.cancel(Timer_EmergencyDwell);
+  timers.cancel(Timer_EmergencyTimeout);
+  if (emergencyStep == Emergency_Drive) stopMotor();
+}
+
+static void emergencyLowerEnter(BridgeInputs& in) {
+  Serial.println("EMERGENCY LOWER TRIGGERED!");
+  emergencyEnter(in);
+}
+static bridgeState emergencyLowerTick(BridgeInputs& in, uint32_t) {
+  return emergencyTick(in, false, emergencyLower, lowered);
+}
+
+static void emergencyRaiseEnter(BridgeInputs& in) {
+  Serial.println("EMERGENCY RAISE TRIGGERED!");
+  emergencyEnter(in);
+}
+static bridgeState emergencyRaiseTick(BridgeInputs& in, uint32_t) {
+  return emergencyTick(in, true, emergencyRaise, raised);
+}
+
+static constexpr FsmRow<bridgeState, BridgeInputs> bridgeStates[] = {
+  { lowered,        loweredEnter,      loweredTick,        nullptr },
+  { prepareRaise,   prepareRaiseEnter, prepareRaiseTick,   prepareRaiseExit },
+  { raising,        raisingEnter,      raisingTick,        raisingExit },
+  { raised,         raisedEnter,       raisedTick,         raisedExit },
+  { prepareLower,   prepareLowerEnter, prepareLowerTick,   prepareLowerExit },
+  { lowering,       loweringEnter,     loweringTick,       loweringExit },
+  { emergencyLower, emergencyLowerEnter, emergencyLowerTick, emergencyExit },
+  { emergencyRaise, emergencyRaiseEnter, emergencyRaiseTick, emergencyExit },
+};
+static Fsm<bridgeState, BridgeInputs, 8, bridgeStates> bridge(lowered);
+
 void stateMachine(bridgeState state) {
   // if (EStop) {
   //   switch (state) {
@@ -60,98 +259,12 @@ void stateMachine(bridgeState state) {
   //   }
   //   EStop = false;
   // }
-  switch (state) {
-    case lowered:
-      digitalWrite(Pin_Status, LOW);
-      digitalWrite(Pin_Buzzer, LOW);
-      digitalWrite(Pin_BoatLight, HIGH);
-      traffic.cycle(2); //2 = Green
-      if (boatDetected()) { boatDetection_count++; }
-      if (boatDetection_count >= boatcount_required) {
-        Serial.println("Boat detected → PREPARE TO RAISE");
-        boatDetection_count = 0;
-        currentState = prepareRaise;
-        Serial.println("STATE: PREP TO RAISE — waiting before lifting");
-        startTime = millis();
-      }
-      break;
-    case prepareRaise:
-      digitalWrite(Pin_BoatLight, HIGH);
-      blink();
-      flash(Pin_Buzzer);
-      flash(Pin_Status);
-      traffic.cycle(1);
-      if (timerFinished(yellowDelay)) {
-        topInterrupt();
-        Serial.println("Prep timer done → RAISING");
-        currentState = raising;
-        startMotorUp();
-      }
-      break;
-    case raising:
-      digitalWrite(Pin_BoatLight, HIGH);
-      digitalWrite(Pin_Status, HIGH);
-      blink();
-      flash(Pin_Buzzer);
-      traffic.cycle(0);
-      startTime = millis();
-      if (topLimitHit()) {
-        stopMotor();
-        Serial.println("STATE: UP (bridge up for boats)");
-        currentState = raised;
-        startTime = millis();
-      }
-      break;
-    case raised:
-      digitalWrite(Pin_Status, LOW);
-      digitalWrite(Pin_Buzzer, LOW);
-      digitalWrite(Pin_BoatLight, LOW);
-      traffic.cycle(0);
-      if (timerUp()) {
-        currentState = prepareLower;
-        Serial.println("STATE: PREP TO LOWER");
-        startTime = millis();
-      }
-      break;
-    case prepareLower:
-      digitalWrite(Pin_Status, HIGH);
-      blink();
-      flash(Pin_Buzzer); 
-      flash(Pin_BoatLight);
-      traffic.cycle(0);
-      if (timerFinished(lowerDelay)) {
-        bottomInterrupt();
-        currentState = lowering;
-        startMotorDown();
-        startTime = millis();
-        Serial.println("STATE: LOWERING");
-      }
-      break;
-    case lowering:
-      digitalWrite(Pin_BoatLight, HIGH);
-      digitalWrite(Pin_Status, HIGH);
-      blink();
-      flash(Pin_Buzzer); 
-      if (bottomLimitHit()) {
-        stopMotor();
-        Serial.println("Bridge fully lowered → DOWN");
-        traffic.cycle(2);
-        currentState = lowered;
-        startTime = millis();
-      }
-      break;
-    case emergencyLower:
-      Serial.println("EMERGENCY LOWER TRIGGERED!");
-      delay(2000);
-      stopMotor();
-      currentState = lowered;
-      break;
-    case emergencyRaise:
-      Serial.println("EMERGENCY RAISE TRIGGERED!");
-      delay(2000);
-      stopMotor();
-      currentState = raised;
-      break;
-    default: break;
-  }
+  uint32_t now = millis();
+  BridgeInputs in = { now, boatDetected(), topLimitHit(), bottomLimitHit() };
+  timers.poll(now);
+
+  // The web page can move the bridge to another state directly; that still
+  // goes through the exit/enter handlers.
+  if (state != bridge.state()) bridge.go(in, state, now);
+  currentState = bridge.tick(in, now);
 }
@@ -22,8 +22,6 @@ bool eStopPressed();
 bool topLimitHit();
 bool bottomLimitHit();
 bool boatDetected();
-bool timerFinished(long delay);
-bool timerUp();
 void startMotorUp();
 void startMotorDown();
 void stopMotor();
@@ -0,0 +1,113 @@
+#ifndef TIMERSERVICE_H
+#define TIMERSERVICE_H
+
+#include <stdint.h>
+
+// Named, cancellable one-shot deadlines kept in a binary min-heap.
+// Each timer is a small integer id (an enum owned by the caller, < N); a
+// state arms its timers in enter() and cancels them in exit(). poll() once
+// per tick costs one comparison against the heap top unless something is
+// actually due, so adding timeouts doesn't add per-tick work. All times are
+// compared as (int32_t)(a - b), so millis() rollover is harmless as long as
+// no deadline is more than ~24 days out.
+template <uint8_t N>
+class TimerService {
+    static_assert(N >= 1 && N <= 32, "TimerService supports 1..32 timers");
+    private:
+        struct Entry {
+            uint32_t due;
+            uint8_t id;
+        };
+        Entry heap[N];
+        uint8_t pos[N];         // heap index of each id, NONE = not armed
+        uint8_t count;
+        uint32_t fired;         // bit per id, set by poll(), cleared by take()
+        static const uint8_t NONE = 0xFF;
+
+        static bool before(uint32_t a, uint32_t b) { return (int32_t)(a - b) < 0; }
+
+        void place(uint8_t i, const Entry& e) { heap[i] = e; pos[e.id] = i; }
+
+        void siftUp(uint8_t i) {
+            Entry e = heap[i];
+            while (i > 0) {
+                uint8_t parent = (i - 1) / 2;
+                if (!before(e.due, heap[parent].due)) break;
+                place(i, heap[parent]);
+                i = parent;
+            }
+            place(i, e);
+        }
+
+        void siftDown(uint8_t i) {
+            Entry e = heap[i];
+            for (;;) {
+                uint8_t c = 2 * i + 1;
+                if (c >= count) break;
+                if (c + 1 < count && before(heap[c + 1].due, heap[c].due)) c++;
+                if (!before(heap[c].due, e.due)) break;
+                place(i, heap[c]);
+                i = c;
+            }
+            place(i, e);
+        }
+
+        void removeAt(uint8_t i) {
+            pos[heap[i].id] = NONE;
+            count--;
+            if (i == count) return;
+            Entry moved = heap[count];
+            place(i, moved);
+            siftDown(i);
+            siftUp(pos[moved.id]);
+        }
+    public:
+        TimerService() : count(0), fired(0) {
+            for (uint8_t i = 0; i < N; i++) pos[i] = NONE;
+        }
+
+        // (Re)arm a timer to fire afterMs from now. Clears an unread expiry.
+        void start(uint8_t id, uint32_t nowMs, uint32_t afterMs) {
+            if (id >= N) return;
+            cancel(id);
+            place(count, Entry{ nowMs + afterMs, id });
+            siftUp(count++);
+        }
+
+        void cancel(uint8_t id) {
+            if (id >= N) return;
+            fired &= ~(1UL << id);
+            if (pos[id] != NONE) removeAt(pos[id]);
+        }
+
+        bool armed(uint8_t id) const { return id < N && pos[id] != NONE; }
+
+        // Move everything that is due into the fired set; returns how many.
+        uint8_t poll(uint32_t nowMs) {
+            uint8_t n = 0;
+            while (count && !before(nowMs, heap[0].due)) {
+                fired |= 1UL << heap[0].id;
+                removeAt(0);
+                n++;
+            }
+            return n;
+        }
+
+        // True once per expiry (check-and-clear).
+        bool take(uint8_t id) {
+            uint32_t bit = 1UL << id;
+            if (id >= N || !(fired & bit)) return false;
+            fired &= ~bit;
+            return true;
+        }
+
+        // ms until the earliest armed timer, 0 if one is already due,
+        // UINT32_MAX if none is armed.
+        uint32_t msUntilNext(uint32_t nowMs) const {
+            if (fired) return 0;
+            if (!count) return UINT32_MAX;
+            return before(nowMs, heap[0].due) ? heap[0].due - nowMs : 0;
+        }
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "TrafficLight.h"
+#include "GpioShadow.h"
 
 TrafficModule::TrafficModule(uint8_t red, uint8_t yellow, uint8_t green) {
     redPin = red;
@@ -8,27 +9,27 @@ TrafficModule::TrafficModule(uint8_t red, uint8_t yellow, uint8_t green) {
 }
 
 void TrafficModule::init() {
-    pinMode(redPin, OUTPUT);
-    pinMode(yellowPin, OUTPUT);
-    pinMode(greenPin, OUTPUT);
+    outputs.attach(redPin);
+    outputs.attach(yellowPin);
+    outputs.attach(greenPin);
 }
 
 void TrafficModule::updateLights() {
     switch (currentState) {
         case 0:
-            digitalWrite(redPin, HIGH);
-            digitalWrite(yellowPin, LOW);
-            digitalWrite(greenPin, LOW);
+            outputs.set(redPin, HIGH);
+            outputs.set(yellowPin, LOW);
+            outputs.set(greenPin, LOW);
             break;
         case 1:
-            digitalWrite(redPin, LOW);
-            digitalWrite(yellowPin, HIGH);
-            digitalWrite(greenPin, LOW);
+            outputs.set(redPin, LOW);
+            outputs.set(yellowPin, HIGH);
+            outputs.set(greenPin, LOW);
             break;
         case 2:
-            digitalWrite(redPin, LOW);
-            digitalWrite(yellowPin, LOW);
-            digitalWrite(greenPin, HIGH);
+            outputs.set(redPin, LOW);
+            outputs.set(yellowPin, LOW);
+            outputs.set(greenPin, HIGH);
             break;
     }
 }
@@ -0,0 +1,319 @@
+// Auto-generated by Convert on 2026-10-16 23:18:04 from webPage.html
+// 24792 bytes of HTML, gzip-compressed to 4807. Send it as is
+// with Content-Encoding: gzip. The hash is FNV-1a of the compressed bytes,
+// and the ETag is the hash quoted, so it changes exactly when the page does.
+
+#ifndef WEBPAGEHTML_H
+#define WEBPAGEHTML_H
+
+#include <Arduino.h>
+
+#define webPage_gzHash     0xe6437234UL
+#define webPage_gzETag     "\"e6437234\""
+#define webPage_gzLength   4807
+
+const uint8_t webPage_gz[webPage_gzLength] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x3d, 0x6b, 0x73, 0xdb, 0xb6,
+    0x96, 0xdf, 0xf3, 0x2b, 0x50, 0xf9, 0x66, 0x24, 0xb5, 0x7a, 0x90, 0xd4, 0xd3, 0xb2, 0xa4, 0x4e,
+    0x9c, 0xa4, 0x69, 0x76, 0xf3, 0x9a, 0x28, 0x77, 0x3b, 0x77, 0x76, 0x76, 0xb6, 0x90, 0x08, 0x4a,
+    0x68, 0x28, 0x52, 0x0b, 0x52, 0x76, 0x9c, 0x5c, 0xff, 0xf7, 0x3d, 0x00, 0x48, 0xf1, 0x05, 0x50,
+    0x94, 0xec, 0xec, 0x76, 0xee, 0xd4, 0x6a, 0x6c, 0x89, 0x38, 0x38, 0x38, 0x6f, 0x9c, 0x73, 0x40,
+    0xaa, 0xd3, 0x1f, 0x5e, 0xbc, 0x7f, 0xfe, 0xe9, 0x1f, 0x1f, 0x5e, 0xa2, 0x4d, 0xb8, 0x75, 0xe7,
+    0x4f, 0xa6, 0xfc, 0x0f, 0x72, 0xb1, 0xb7, 0x9e, 0xd5, 0x88, 0x57, 0xe3, 0x17, 0x08, 0xb6, 0xe7,
+    0x4f, 0x10, 0xfc, 0x4c, 0xb7, 0x24, 0xc4, 0x68, 0xb5, 0xc1, 0x2c, 0x20, 0xe1, 0xac, 0xb6, 0x0f,
+    0x9d, 0xf6, 0xb8, 0xd6, 0x4d, 0x8f, 0x79, 0x78, 0x4b, 0x66, 0xb5, 0x1b, 0x4a, 0x6e, 0x77, 0x3e,
+    0x0b, 0x6b, 0x68, 0xe5, 0x7b, 0x21, 0xf1, 0x00, 0xf6, 0x96, 0xda, 0xe1, 0x66, 0x66, 0x93, 0x1b,
+    0xba, 0x22, 0x6d, 0xf1, 0xa1, 0x85, 0xa8, 0x47, 0x43, 0x8a, 0xdd, 0x76, 0xb0, 0xc2, 0x2e, 0x99,
+    0x99, 0x1d, 0xe3, 0x80, 0x2b, 0xa4, 0xa1, 0x4b, 0xe6, 0xe8, 0x2d, 0xb5, 0x17, 0x64, 0x8b, 0x7e,
+    0x7b, 0x36, 0x46, 0xcf, 0x01, 0x11, 0xf3, 0x5d, 0xf4, 0x01, 0x7b, 0xc4, 0x45, 0xd3, 0xae, 0x84,
+    0x90, 0xd0, 0x41, 0x78, 0x17, 0xbf, 0xe7, 0x3f, 0x13, 0xe6, 0xfb, 0xe1, 0xb7, 0xc3, 0x47, 0xfe,
+    0xd3, 0x6e, 0x2f, 0x7d, 0x66, 0x13, 0x26, 0x16, 0x9e, 0x20, 0x63, 0xf7, 0xe5, 0x2a, 0x3f, 0xbe,
+    0x0f, 0x43, 0xdf, 0xfb, 0x48, 0xd6, 0xef, 0xbd, 0x09, 0x5a, 0x33, 0x42, 0x3c, 0x3d, 0x84, 0xe3,
+    0x4c, 0x10, 0x23, 0x76, 0x1e, 0x20, 0x64, 0xd8, 0x71, 0xe8, 0xea, 0x23, 0xb1, 0x01, 0xc7, 0x85,
+    0xe3, 0x58, 0x4b, 0x6b, 0x59, 0x02, 0xc3, 0xb1, 0x5c, 0xf4, 0xb0, 0x61, 0x1b, 0x25, 0x98, 0x5e,
+    0xb9, 0xfe, 0x2d, 0x2c, 0xb6, 0x5e, 0xe2, 0x86, 0x35, 0x18, 0xb4, 0x50, 0xdf, 0x90, 0xff, 0x8c,
+    0xce, 0x70, 0xd0, 0xd4, 0x4c, 0xfb, 0x07, 0x71, 0x61, 0x16, 0xe7, 0x03, 0x88, 0xb0, 0xfb, 0x86,
+    0x51, 0x0e, 0x17, 0xd1, 0xd1, 0xb3, 0x8e, 0x00, 0xe6, 0x49, 0xb1, 0x4c, 0x0b, 0xe8, 0xe0, 0xa4,
+    0x0c, 0xb4, 0xa4, 0xbc, 0xe2, 0x82, 0x14, 0x94, 0x98, 0x84, 0xe0, 0x01, 0x2e, 0x05, 0x13, 0x84,
+    0x18, 0xc4, 0xc2, 0x66, 0x29, 0x5c, 0x8a, 0x8e, 0x1e, 0x2c, 0x6f, 0xf5, 0xfa, 0x2d, 0x74, 0x79,
+    0x84, 0x8e, 0x5f, 0xfd, 0x7d, 0x40, 0xbd, 0x35, 0xa7, 0xc3, 0x34, 0x35, 0x30, 0xd7, 0xe4, 0x2b,
+    0x71, 0x39, 0x05, 0x45, 0x39, 0x90, 0x20, 0xf4, 0x77, 0xc0, 0x86, 0x42, 0xe9, 0x72, 0x08, 0x48,
+    0xb7, 0x31, 0xfb, 0xfc, 0xb1, 0x38, 0xce, 0x9d, 0xe7, 0x17, 0xb0, 0xc7, 0x09, 0x02, 0x23, 0x5f,
+    0x35, 0x4c, 0xc3, 0x78, 0x8a, 0xda, 0xa8, 0x71, 0x83, 0x59, 0x23, 0x63, 0x94, 0xcd, 0x1f, 0xad,
+    0x66, 0x81, 0xfa, 0x60, 0xe3, 0xdf, 0x7e, 0xc2, 0x40, 0x76, 0xc8, 0xf6, 0xa4, 0x60, 0x8f, 0x78,
+    0xf5, 0xf9, 0x0d, 0x5d, 0x6f, 0xc2, 0xc9, 0x85, 0x35, 0xb6, 0x9c, 0x9e, 0x12, 0x00, 0x3c, 0x08,
+    0x4d, 0x40, 0xf8, 0x56, 0xcf, 0x72, 0x54, 0xe3, 0x2f, 0x80, 0xea, 0x08, 0xa6, 0x6f, 0x8e, 0x4c,
+    0x2d, 0xcc, 0xe4, 0xc2, 0x70, 0x40, 0x74, 0x83, 0x02, 0x85, 0x21, 0x0e, 0xc9, 0x0b, 0xe2, 0xe0,
+    0xbd, 0x0b, 0x2c, 0x5e, 0x58, 0xa4, 0x37, 0xee, 0x17, 0xcd, 0x99, 0x7c, 0x09, 0x9f, 0xfb, 0xae,
+    0xbf, 0x67, 0x09, 0xe4, 0xe5, 0xe5, 0x65, 0x01, 0x8c, 0xbb, 0xb4, 0x84, 0x03, 0x00, 0xdb, 0xb1,
+    0x89, 0x9d, 0xe2, 0xe9, 0xfe, 0xf0, 0x0e, 0xa3, 0xac, 0x73, 0xaf, 0x60, 0x0a, 0x13, 0xf2, 0xcf,
+    0xe8, 0x27, 0x99, 0xf0, 0x63, 0x6e, 0xc2, 0x16, 0xb3, 0x35, 0x05, 0xa3, 0x1c, 0xa4, 0xc3, 0x40,
+    0x02, 0xbe, 0xf4, 0xed, 0xbb, 0xdc, 0x0c, 0xa9, 0xa8, 0x09, 0x2a, 0xaa, 0x0d, 0x05, 0xbe, 0x0b,
+    0xf2, 0x5b, 0xba, 0x20, 0xa8, 0x2c, 0x43, 0x36, 0x0d, 0x76, 0x2e, 0xbe, 0x9b, 0x38, 0x2e, 0xf9,
+    0x72, 0x85, 0x32, 0x43, 0x0e, 0x04, 0xb3, 0xb6, 0x83, 0xb7, 0xd4, 0xbd, 0x9b, 0xa0, 0x67, 0x0c,
+    0x62, 0x60, 0x0b, 0xfd, 0x4a, 0xdc, 0x1b, 0x12, 0xd2, 0x15, 0x6e, 0xa1, 0x00, 0x7b, 0x41, 0x3b,
+    0x20, 0x8c, 0xe6, 0xd4, 0x21, 0x19, 0xbd, 0x20, 0x4b, 0xfe, 0xca, 0x0e, 0x71, 0x11, 0xb7, 0xb1,
+    0x4b, 0xd7, 0xc0, 0xd6, 0x0a, 0x02, 0x2e, 0x61, 0xd9, 0x71, 0x4e, 0x44, 0xdb, 0xa6, 0x8c, 0xac,
+    0x42, 0xea, 0x73, 0x18, 0xdf, 0xdd, 0x6f, 0x73, 0x21, 0x6e, 0x4b, 0xbd, 0x76, 0x14, 0x20, 0xf9,
+    0xdb, 0x28, 0x74, 0x17, 0x61, 0x36, 0x44, 0x58, 0x1d, 0x02, 0x5b, 0xbe, 0xd9, 0x5c, 0xa9, 0x24,
+    0x9b, 0x73, 0xa0, 0x1d, 0xb6, 0x6d, 0xee, 0x7d, 0xb9, 0xcb, 0x72, 0x2d, 0xee, 0x11, 0xd9, 0xeb,
+    0x82, 0x8d, 0x36, 0x0d, 0xc9, 0x36, 0x98, 0xa8, 0x78, 0xe1, 0x36, 0xb9, 0x66, 0xfe, 0xde, 0xb3,
+    0x27, 0x2e, 0xf5, 0x08, 0x66, 0xed, 0x35, 0xc3, 0x36, 0x05, 0xc8, 0xd8, 0xad, 0xa4, 0xe1, 0x37,
+    0x5b, 0x28, 0xf9, 0x2c, 0x3c, 0xa5, 0xd9, 0xd2, 0x03, 0x70, 0x2b, 0x4f, 0x7b, 0x60, 0x62, 0x0f,
+    0xdc, 0x85, 0x09, 0x3b, 0xd1, 0x20, 0x0a, 0xa1, 0x42, 0xc2, 0xb4, 0x39, 0xa5, 0xfb, 0x80, 0x0b,
+    0x2f, 0xbf, 0x07, 0x45, 0xa2, 0x97, 0x18, 0xe3, 0xb0, 0xd1, 0x54, 0xdb, 0x94, 0xd0, 0x67, 0xb9,
+    0x86, 0x99, 0x7f, 0xab, 0x17, 0xab, 0xd2, 0x46, 0xfe, 0xd8, 0x07, 0x21, 0x75, 0xee, 0x62, 0xc5,
+    0x4f, 0x50, 0xb0, 0xc3, 0xb0, 0x59, 0x93, 0x1b, 0xe2, 0xb9, 0x77, 0x4a, 0xc1, 0x98, 0x2d, 0xb4,
+    0xb1, 0x54, 0xce, 0x18, 0x71, 0x91, 0xf2, 0x68, 0xb5, 0x64, 0x7b, 0x80, 0x00, 0xc2, 0xf7, 0x06,
+    0xb6, 0x13, 0x17, 0x2f, 0x89, 0xab, 0xc2, 0x15, 0xa1, 0xca, 0xc7, 0x10, 0x25, 0xc2, 0xce, 0x16,
+    0x7b, 0x7b, 0xec, 0x7e, 0xf2, 0xd7, 0x6b, 0x97, 0x9c, 0xec, 0xc2, 0xf9, 0x18, 0x1b, 0x0b, 0x24,
+    0x20, 0xae, 0x23, 0x45, 0xde, 0x26, 0x9e, 0x32, 0xc2, 0x74, 0x04, 0xa7, 0x0f, 0x8f, 0x19, 0x29,
+    0xd3, 0xce, 0x59, 0xe6, 0x89, 0xc6, 0x14, 0xbb, 0x9c, 0x18, 0x42, 0x56, 0xff, 0x69, 0x65, 0x3b,
+    0xca, 0x32, 0x7d, 0x4e, 0x2c, 0x49, 0xc4, 0xb2, 0xc5, 0xd4, 0x3b, 0x51, 0x28, 0x8a, 0xd4, 0x2b,
+    0x13, 0x48, 0x4f, 0xb3, 0x79, 0x01, 0x00, 0x02, 0x85, 0x84, 0xc1, 0x3c, 0xcb, 0xd8, 0x0b, 0x8e,
+    0x13, 0x84, 0x8c, 0x84, 0xab, 0x8d, 0x0a, 0xe2, 0x80, 0x4a, 0x25, 0xb4, 0x28, 0x68, 0x66, 0xa3,
+    0x5d, 0xca, 0x80, 0x02, 0x6a, 0x93, 0x6b, 0x9c, 0x8f, 0x32, 0x07, 0x73, 0x68, 0x67, 0xfc, 0xaa,
+    0xd4, 0x2a, 0x4e, 0x32, 0xf1, 0xbc, 0x21, 0x0d, 0xf3, 0x86, 0x54, 0x5d, 0xf8, 0xaa, 0x2d, 0x45,
+    0xc0, 0xdc, 0x32, 0xbc, 0x9b, 0x20, 0xfe, 0xfb, 0x71, 0x54, 0xa0, 0x12, 0x6f, 0x05, 0x0d, 0x28,
+    0xbc, 0x19, 0xb2, 0x17, 0x16, 0xaa, 0x10, 0x49, 0x98, 0x82, 0xae, 0x33, 0x81, 0x86, 0x7a, 0xd7,
+    0xae, 0xbf, 0xfa, 0x7c, 0xa2, 0x7d, 0xdf, 0x89, 0x5c, 0xfa, 0xea, 0xe1, 0x6a, 0xfe, 0x93, 0xe8,
+    0x4c, 0xaf, 0x8c, 0x87, 0x69, 0x6b, 0x8b, 0xbf, 0x44, 0xc9, 0xc8, 0x68, 0xac, 0xc9, 0xd3, 0x02,
+    0xc9, 0xc5, 0x89, 0xa9, 0xda, 0x49, 0xa2, 0xd2, 0x89, 0x41, 0x1f, 0x57, 0xd6, 0x30, 0xa1, 0x18,
+    0x8e, 0xff, 0x4f, 0xc4, 0x96, 0x48, 0xe6, 0x42, 0xd6, 0xaa, 0x81, 0x4a, 0x32, 0xb1, 0x89, 0x69,
+    0x72, 0xe5, 0x0b, 0x91, 0xd1, 0x97, 0xce, 0x5c, 0xfb, 0xae, 0x4d, 0x3c, 0xe6, 0xa7, 0xe7, 0x27,
+    0xf9, 0xad, 0x03, 0x59, 0x0b, 0x61, 0xe8, 0xc1, 0x9b, 0x6f, 0xb4, 0xd8, 0xc5, 0x68, 0x34, 0x52,
+    0x65, 0xcf, 0x01, 0xfd, 0x4a, 0x26, 0x66, 0x7f, 0x97, 0x4f, 0xad, 0x8f, 0x25, 0xc2, 0xd2, 0xa6,
+    0x4a, 0x93, 0xac, 0x68, 0xef, 0x6c, 0x43, 0x61, 0xa7, 0x50, 0xa5, 0x4c, 0x71, 0xc5, 0x20, 0x32,
+    0x94, 0xa1, 0x61, 0xe9, 0x7f, 0xf9, 0x8e, 0x26, 0x79, 0xc4, 0x7b, 0x1f, 0x6e, 0x69, 0x29, 0x4e,
+    0x56, 0xb2, 0xe9, 0x22, 0x7b, 0x2e, 0x0f, 0xd6, 0xe8, 0x09, 0xc9, 0xeb, 0xff, 0x43, 0x5c, 0x2a,
+    0xb2, 0xad, 0x0f, 0xef, 0xe7, 0x94, 0x81, 0xe8, 0xdc, 0xf4, 0xe5, 0x7b, 0x6f, 0x9f, 0xe9, 0x24,
+    0x84, 0xfb, 0xbe, 0xd0, 0xf6, 0x43, 0xab, 0x9d, 0x3f, 0xf5, 0x16, 0x94, 0xe2, 0x78, 0x77, 0x06,
+    0xb3, 0x3e, 0xc3, 0xde, 0x9a, 0x7c, 0x0f, 0x2d, 0x7f, 0x1f, 0x66, 0x73, 0xfa, 0x3d, 0x27, 0x6b,
+    0x79, 0x50, 0x56, 0xfe, 0xbd, 0xc3, 0x54, 0xb4, 0xdb, 0x5d, 0xfb, 0x5f, 0xd0, 0x03, 0x93, 0xb1,
+    0xfc, 0x36, 0x78, 0x06, 0xca, 0x1d, 0xf5, 0x3e, 0x9f, 0xa0, 0xff, 0xbc, 0xf3, 0xa9, 0x2a, 0xd7,
+    0x5c, 0x2d, 0x57, 0xd8, 0x91, 0x8e, 0x16, 0x83, 0xc5, 0xfc, 0xb2, 0xdd, 0xbe, 0x7a, 0xa2, 0xea,
+    0x7c, 0x09, 0x41, 0x2a, 0x39, 0xf6, 0x7c, 0x2f, 0xbf, 0x41, 0xef, 0x59, 0x00, 0xb8, 0x76, 0x3e,
+    0xd5, 0x7a, 0x97, 0xc4, 0xf7, 0x7d, 0x78, 0xf2, 0x21, 0x7d, 0xdf, 0x60, 0x9b, 0xa7, 0x60, 0x1c,
+    0x05, 0xff, 0x37, 0x88, 0xfe, 0xf2, 0x56, 0xe0, 0x21, 0x49, 0x69, 0x1d, 0x86, 0x63, 0x10, 0x45,
+    0x90, 0x0e, 0xc1, 0xa5, 0x03, 0x2a, 0xf4, 0x23, 0xde, 0x3a, 0x3e, 0xdb, 0xa2, 0x8e, 0x19, 0x20,
+    0x82, 0x03, 0x72, 0x94, 0xb5, 0x09, 0x06, 0xd5, 0xde, 0xe4, 0x38, 0x3c, 0xe0, 0x99, 0x88, 0xe3,
+    0x8d, 0x86, 0xd1, 0x19, 0x37, 0x8f, 0x62, 0xea, 0x90, 0x05, 0x24, 0x16, 0x1a, 0x51, 0x29, 0xdb,
+    0x67, 0x68, 0x5c, 0x10, 0x4d, 0xdc, 0x9f, 0x1b, 0x1f, 0x93, 0xea, 0x20, 0xdf, 0x79, 0x4b, 0xb5,
+    0x1f, 0x22, 0x0b, 0x8f, 0x3a, 0xdf, 0x15, 0x28, 0x2f, 0xd8, 0x4d, 0xa1, 0x95, 0x91, 0x9c, 0xb0,
+    0x54, 0x41, 0xe7, 0x38, 0x95, 0xf1, 0x39, 0x4e, 0x53, 0x1d, 0xef, 0xa8, 0xcd, 0x8f, 0x8d, 0xa0,
+    0x52, 0x3b, 0xb9, 0x7d, 0xa7, 0x2a, 0xd3, 0x1e, 0x98, 0xbf, 0x54, 0xdd, 0x92, 0xa8, 0x7d, 0x7d,
+    0x6a, 0x02, 0x59, 0xba, 0x25, 0x3d, 0x02, 0xb5, 0xba, 0x62, 0x99, 0x17, 0x3b, 0x9a, 0xe2, 0x6c,
+    0x33, 0xc8, 0xb2, 0x70, 0xbb, 0x01, 0x5c, 0x6d, 0x91, 0xa2, 0x40, 0x2c, 0x51, 0x54, 0x54, 0x87,
+    0xa4, 0x7e, 0xe5, 0xe2, 0xed, 0x0e, 0xdc, 0x65, 0x38, 0x22, 0x5b, 0x7e, 0xaa, 0x33, 0xee, 0xf1,
+    0xbf, 0x26, 0xd9, 0xaa, 0xad, 0x26, 0x3a, 0xbd, 0x11, 0xfd, 0xdd, 0xfc, 0xa1, 0xdf, 0x02, 0x78,
+    0x8b, 0xb0, 0x0d, 0x38, 0x92, 0x3e, 0xff, 0x35, 0xc8, 0x60, 0x2a, 0x74, 0x5e, 0x17, 0x4d, 0x4d,
+    0x27, 0x4d, 0x9c, 0xdf, 0xc4, 0x30, 0xe8, 0x47, 0xa3, 0x63, 0x5a, 0xcd, 0xca, 0x8d, 0xe9, 0x0b,
+    0x13, 0xf3, 0x57, 0x8b, 0x1f, 0x70, 0xf1, 0x97, 0xa6, 0x73, 0x53, 0x58, 0xc3, 0x30, 0xfb, 0xb1,
+    0x8e, 0x8b, 0x07, 0x53, 0x39, 0x77, 0xce, 0x4c, 0x56, 0xd1, 0x17, 0x5b, 0xc4, 0x9a, 0xe5, 0x6b,
+    0x0e, 0xae, 0xc8, 0xdc, 0xda, 0x20, 0x79, 0xd3, 0x6c, 0xea, 0x83, 0x2e, 0xf5, 0x02, 0x12, 0x22,
+    0xa3, 0xb0, 0xaa, 0x31, 0x68, 0x16, 0xaf, 0x5d, 0x36, 0x93, 0x83, 0x43, 0x79, 0x78, 0xc8, 0x7f,
+    0x09, 0xe0, 0x96, 0x06, 0x13, 0x6a, 0xc3, 0x70, 0x4f, 0x81, 0xcc, 0x34, 0x22, 0x64, 0x46, 0x4b,
+    0xbc, 0x3a, 0x43, 0x03, 0x90, 0x28, 0x08, 0x19, 0x29, 0xe6, 0xf6, 0x8b, 0x73, 0x95, 0x56, 0x75,
+    0x0b, 0xfe, 0x8f, 0xb4, 0x01, 0x08, 0xe5, 0xd5, 0x6b, 0x8e, 0x0d, 0x9b, 0xac, 0xb9, 0x76, 0x6d,
+    0xfe, 0x42, 0xc6, 0x53, 0xfe, 0x7e, 0xc4, 0x5f, 0xfc, 0x98, 0xe4, 0xa9, 0xc6, 0xa6, 0x8a, 0x22,
+    0x37, 0x86, 0xa5, 0xcd, 0x1e, 0x85, 0x2c, 0x94, 0x86, 0x54, 0x90, 0xc5, 0xb8, 0xcc, 0x8a, 0x2a,
+    0x28, 0x75, 0x58, 0xa2, 0x87, 0x44, 0xa1, 0xb1, 0x56, 0x87, 0x29, 0xad, 0xb6, 0x15, 0x6a, 0x1d,
+    0x37, 0x55, 0xc6, 0x9a, 0xd5, 0xcc, 0x48, 0xad, 0x18, 0xee, 0xce, 0x39, 0xc5, 0x48, 0xf7, 0xa5,
+    0xde, 0x86, 0x30, 0x9a, 0xef, 0xe6, 0x05, 0x3b, 0x08, 0x72, 0x20, 0x3d, 0x08, 0x74, 0x90, 0x45,
+    0x74, 0xcd, 0x13, 0xf7, 0x43, 0xb5, 0x5b, 0x72, 0x16, 0x7b, 0x7a, 0x81, 0xee, 0xfc, 0x28, 0x95,
+    0x80, 0xb2, 0xc8, 0xc5, 0x3c, 0x33, 0xd0, 0xef, 0xb2, 0x7c, 0x69, 0xec, 0xa6, 0x0c, 0x69, 0x68,
+    0x3c, 0x45, 0xa6, 0x05, 0xbf, 0x70, 0x88, 0x7a, 0xf0, 0xa7, 0xc7, 0x4d, 0x49, 0x2d, 0x66, 0x13,
+    0xc4, 0xc8, 0x47, 0x45, 0xa6, 0xb1, 0xc3, 0x0c, 0xe6, 0xa3, 0xde, 0xe0, 0x69, 0xea, 0x54, 0x2b,
+    0x10, 0x87, 0x2f, 0x0c, 0x6c, 0xd1, 0xb2, 0xac, 0x53, 0x7d, 0x19, 0xe9, 0x7c, 0xc8, 0xaa, 0xa4,
+    0x77, 0x95, 0xb9, 0x1c, 0x75, 0xc7, 0x7e, 0xfe, 0x04, 0x3f, 0x95, 0x98, 0xa5, 0x28, 0x46, 0x66,
+    0xdf, 0xd8, 0xca, 0xe4, 0xac, 0x55, 0xc8, 0x6e, 0x33, 0x83, 0x0e, 0x75, 0x79, 0x37, 0x2a, 0xb9,
+    0xa4, 0x35, 0x2a, 0x9e, 0x71, 0xe4, 0x0c, 0x4b, 0x4e, 0x86, 0xc2, 0x1a, 0x87, 0x7b, 0x30, 0x21,
+    0x91, 0xc3, 0x41, 0x40, 0x5a, 0x32, 0xbe, 0xd7, 0x78, 0x24, 0x08, 0xe0, 0xc2, 0x68, 0x50, 0x41,
+    0xae, 0x06, 0x1a, 0x43, 0xde, 0x99, 0xe1, 0x74, 0xdc, 0x2c, 0xa1, 0xc4, 0xeb, 0x40, 0x41, 0x8d,
+    0x0a, 0xb7, 0xb0, 0xc4, 0xfa, 0x3c, 0x1c, 0xaf, 0xa5, 0x6e, 0x38, 0x69, 0x56, 0x6d, 0x29, 0x47,
+    0x38, 0x4a, 0xa8, 0x36, 0x8a, 0x96, 0x80, 0xa4, 0xae, 0xd4, 0x7e, 0x90, 0xc7, 0xdc, 0xca, 0x76,
+    0xe4, 0xd2, 0x3f, 0x6a, 0xd4, 0x3d, 0x43, 0x89, 0x7a, 0xa8, 0x40, 0xad, 0xc5, 0xac, 0x31, 0x61,
+    0xa4, 0xb0, 0x61, 0xc9, 0x4e, 0xb9, 0x15, 0x9f, 0xb1, 0x8e, 0xa9, 0xe4, 0x22, 0x65, 0xe2, 0x28,
+    0xfa, 0x2f, 0x6b, 0xe5, 0x0a, 0x33, 0x3c, 0x59, 0xfb, 0xb9, 0x04, 0xb8, 0x60, 0x4d, 0x32, 0x9b,
+    0xad, 0x8c, 0x32, 0xbe, 0x81, 0xe8, 0x2f, 0x9b, 0xfa, 0x17, 0xb2, 0xa9, 0xf3, 0x6c, 0xe0, 0x98,
+    0x65, 0x89, 0xc6, 0x50, 0x65, 0xa4, 0xd1, 0xed, 0x60, 0x7f, 0xd9, 0xd5, 0xbf, 0x90, 0x5d, 0x9d,
+    0x63, 0x01, 0x3a, 0xab, 0x12, 0x2d, 0xb0, 0x57, 0x50, 0x9d, 0x9c, 0xd6, 0x75, 0x57, 0x15, 0xeb,
+    0xea, 0x73, 0xb8, 0x92, 0x0a, 0x08, 0xae, 0xb4, 0xa1, 0xda, 0x85, 0x61, 0xa8, 0x53, 0x65, 0x45,
+    0x1c, 0xf0, 0x0c, 0x6e, 0x47, 0x70, 0xd8, 0xe8, 0x43, 0x01, 0xea, 0xb0, 0x12, 0xa2, 0x9f, 0x03,
+    0x09, 0xdf, 0x4e, 0x3a, 0x88, 0x8a, 0x6b, 0x00, 0x7e, 0x7c, 0xcb, 0xd3, 0x83, 0xd2, 0xcc, 0x74,
+    0x7c, 0xbc, 0xa5, 0x27, 0xa5, 0x93, 0xbe, 0x1f, 0xaf, 0xa9, 0xa8, 0xb0, 0x6f, 0xa3, 0xde, 0xd0,
+    0xd2, 0x77, 0xed, 0xab, 0x92, 0x1b, 0x77, 0x4a, 0xee, 0xb6, 0x29, 0xba, 0xa0, 0x05, 0x1c, 0xf4,
+    0xf3, 0x09, 0x8e, 0xa9, 0xcf, 0xe4, 0x0a, 0x19, 0x1b, 0xb8, 0x55, 0x3e, 0x3b, 0xcb, 0xf6, 0x04,
+    0x90, 0x38, 0xe9, 0xcb, 0xca, 0xcf, 0xe5, 0xa7, 0x1d, 0x15, 0x0e, 0x43, 0x13, 0x05, 0x95, 0xf4,
+    0xa8, 0x0e, 0x67, 0x9b, 0xc5, 0x46, 0xb7, 0x50, 0xa4, 0x4d, 0x56, 0xbe, 0xa8, 0x22, 0xbc, 0x18,
+    0x52, 0x34, 0x34, 0x8e, 0xad, 0xa7, 0x6f, 0x62, 0x55, 0x56, 0xdb, 0xb1, 0xe5, 0xb2, 0xeb, 0xee,
+    0x83, 0x87, 0xde, 0x42, 0x75, 0x41, 0xb6, 0xd7, 0x71, 0x3f, 0xfd, 0xd4, 0xde, 0xf7, 0x9e, 0xed,
+    0x5c, 0xa2, 0xbf, 0x9f, 0x42, 0xd5, 0x46, 0xca, 0xcb, 0xad, 0x53, 0x38, 0xd0, 0xaf, 0x26, 0x6f,
+    0x45, 0xfa, 0x5e, 0xd9, 0xa2, 0x25, 0xae, 0x69, 0x37, 0x75, 0x1f, 0xf9, 0x34, 0x58, 0x31, 0xba,
+    0x0b, 0x93, 0x9b, 0xca, 0x6f, 0xa9, 0x07, 0xd6, 0x0e, 0xd4, 0xb9, 0x3e, 0xb6, 0xd1, 0x0c, 0x39,
+    0x7b, 0x4f, 0x74, 0xcf, 0x1a, 0xcd, 0xc2, 0xaa, 0x5e, 0x10, 0x22, 0x41, 0x13, 0x80, 0x7d, 0x2b,
+    0x04, 0xe7, 0xdd, 0xc6, 0x0f, 0x7d, 0x6e, 0x1d, 0x0b, 0x0e, 0x32, 0x91, 0x5b, 0x4d, 0x71, 0xaf,
+    0x08, 0x7c, 0x8f, 0xae, 0x52, 0x20, 0x1a, 0xb0, 0x74, 0xf7, 0x2b, 0x86, 0x56, 0x80, 0x41, 0xc9,
+    0x62, 0xaf, 0x49, 0x16, 0x9d, 0x59, 0x04, 0xf3, 0x40, 0x48, 0xb9, 0x35, 0x51, 0xfd, 0x1d, 0x5c,
+    0x44, 0xe2, 0x6a, 0x3d, 0x3b, 0x23, 0xd5, 0x69, 0x4d, 0x18, 0x8f, 0x08, 0x52, 0xb2, 0x0e, 0x69,
+    0xed, 0x04, 0xd9, 0xfe, 0x6a, 0xbf, 0x05, 0x67, 0xed, 0xac, 0x49, 0xf8, 0xd2, 0x25, 0xfc, 0xed,
+    0xf5, 0xdd, 0x6b, 0xbb, 0x51, 0x87, 0xd1, 0x4f, 0x72, 0x72, 0x5d, 0xb1, 0x77, 0xca, 0x18, 0x5f,
+    0x32, 0x5d, 0x02, 0x94, 0x60, 0x10, 0xae, 0x5d, 0x82, 0x40, 0x8c, 0x6b, 0xe6, 0x03, 0xab, 0xd9,
+    0xc8, 0x14, 0x69, 0x1f, 0x81, 0x01, 0xdc, 0x80, 0x05, 0x30, 0x02, 0x15, 0xa2, 0x87, 0x6e, 0xd0,
+    0x6c, 0x36, 0x43, 0x26, 0xfa, 0xe7, 0x3f, 0xa3, 0xb7, 0x35, 0xb3, 0x96, 0x7c, 0x10, 0x37, 0x71,
+    0xdf, 0xab, 0xf1, 0xc0, 0x46, 0x7d, 0x1d, 0x7a, 0x8d, 0x65, 0xe8, 0xb5, 0x00, 0xa7, 0x90, 0x76,
+    0x8b, 0x3f, 0x68, 0xe1, 0xad, 0xc9, 0x27, 0x90, 0x7f, 0x53, 0x21, 0x4d, 0x80, 0xed, 0xac, 0x5c,
+    0x1c, 0x04, 0x6f, 0x68, 0x10, 0x76, 0x42, 0xd1, 0x36, 0x6f, 0xd4, 0x7d, 0xaf, 0x7e, 0xc0, 0x90,
+    0x8b, 0x24, 0x25, 0x93, 0x1c, 0x07, 0x66, 0xfd, 0x50, 0x3e, 0x4d, 0x7a, 0x90, 0x08, 0xb7, 0xa0,
+    0xdd, 0x84, 0x36, 0xf4, 0x73, 0xbc, 0xde, 0xcf, 0xf5, 0x67, 0xe2, 0x20, 0xa4, 0x3e, 0xa9, 0xbf,
+    0xf6, 0xe2, 0xb7, 0xb9, 0xa9, 0x6a, 0xdc, 0xc0, 0xfe, 0xb3, 0x30, 0x64, 0x74, 0xb9, 0x87, 0x2a,
+    0xbb, 0x8e, 0x19, 0xc5, 0xed, 0x1d, 0x83, 0x02, 0x9b, 0xd8, 0x09, 0x37, 0xb0, 0x4e, 0x9d, 0x8b,
+    0xb0, 0x8e, 0x26, 0xa8, 0xee, 0x60, 0x37, 0x20, 0xf5, 0x1c, 0xa5, 0xa5, 0xb2, 0x7d, 0x41, 0x03,
+    0xbc, 0x04, 0x66, 0xff, 0x12, 0xf1, 0x43, 0x44, 0x2c, 0xd2, 0x4a, 0x07, 0x71, 0x29, 0x72, 0x07,
+    0xd2, 0x61, 0x6c, 0x82, 0xbd, 0x8b, 0xf9, 0x4d, 0xb1, 0xb6, 0x2d, 0x65, 0xcf, 0xe3, 0x66, 0xf1,
+    0x49, 0x06, 0xbd, 0xd6, 0x16, 0xd1, 0x19, 0x6c, 0x83, 0xb8, 0x89, 0xc0, 0x15, 0x6a, 0x22, 0xee,
+    0xe9, 0x5a, 0x52, 0xcf, 0x29, 0x53, 0x92, 0x9e, 0xce, 0x4f, 0xa9, 0x20, 0xdc, 0x08, 0x74, 0x54,
+    0x62, 0xd7, 0x85, 0xc4, 0xb7, 0xa1, 0xa0, 0x25, 0xb8, 0xa5, 0xe1, 0x6a, 0xa3, 0x9f, 0x29, 0xa2,
+    0x2b, 0x64, 0x47, 0xc8, 0x98, 0xf0, 0xe5, 0xde, 0x7b, 0x8d, 0x28, 0xca, 0xf2, 0x46, 0x41, 0xf3,
+    0x0a, 0xa2, 0x3b, 0xc1, 0x9f, 0xaf, 0xf4, 0xd3, 0xcc, 0xfc, 0x34, 0x19, 0x2b, 0x2b, 0xcc, 0xb4,
+    0xf2, 0x33, 0x45, 0x90, 0xd4, 0x4f, 0xbc, 0xaf, 0x22, 0xb1, 0x58, 0x10, 0x0a, 0x4e, 0xff, 0x33,
+    0xc5, 0x58, 0x0b, 0x65, 0xc9, 0x4d, 0x3e, 0x0b, 0x22, 0xfe, 0xab, 0xe3, 0xf8, 0xec, 0x25, 0x06,
+    0xb9, 0x11, 0x17, 0xcd, 0xe6, 0x1a, 0xb1, 0x65, 0xd4, 0xcc, 0xc8, 0xd6, 0xbf, 0x91, 0xa6, 0xd1,
+    0xbc, 0x3a, 0x0e, 0x0e, 0x09, 0xba, 0x34, 0x09, 0x0d, 0xb0, 0xdc, 0xf0, 0xc4, 0x7d, 0xeb, 0x60,
+    0xd8, 0x99, 0xa9, 0x2b, 0x79, 0xec, 0x18, 0x88, 0x5d, 0xad, 0xde, 0xe4, 0x7e, 0xf5, 0x11, 0xde,
+    0x80, 0x5b, 0x69, 0x8b, 0x35, 0x0d, 0x11, 0x09, 0x26, 0x29, 0x05, 0x89, 0x4c, 0x56, 0xe7, 0xc2,
+    0x4d, 0x45, 0x45, 0x55, 0xd7, 0xb2, 0xa3, 0x70, 0x7b, 0x41, 0x71, 0x3d, 0xba, 0xe3, 0x1e, 0xfd,
+    0x84, 0xea, 0xc8, 0xe5, 0x96, 0x8b, 0x34, 0xac, 0xde, 0x57, 0xf6, 0x03, 0xb0, 0x13, 0xe2, 0x1e,
+    0x75, 0xd0, 0x83, 0x16, 0xd4, 0xcb, 0x29, 0x54, 0xa0, 0x54, 0xd7, 0xe3, 0x4b, 0xff, 0x71, 0xe4,
+    0x7e, 0xa2, 0xcc, 0xbd, 0xe2, 0x26, 0x96, 0xf9, 0xd8, 0xed, 0x66, 0x44, 0x2c, 0x43, 0xbe, 0x08,
+    0x4f, 0x32, 0x5e, 0xbc, 0xdb, 0x6f, 0xf3, 0x12, 0x87, 0x29, 0xb2, 0x7a, 0x62, 0xa8, 0xe1, 0x92,
+    0x10, 0x51, 0x90, 0x8f, 0x79, 0x85, 0xe8, 0x74, 0x36, 0xbe, 0xa2, 0x3f, 0xfd, 0xa4, 0x01, 0x4f,
+    0x64, 0xba, 0xe2, 0x67, 0x5f, 0x33, 0x6d, 0xa2, 0xf4, 0xbb, 0x58, 0xb7, 0xfd, 0xb7, 0x6f, 0xf4,
+    0xfe, 0xf7, 0x1c, 0xed, 0x29, 0x54, 0x7c, 0x93, 0xf8, 0x81, 0x63, 0x6a, 0x8a, 0x67, 0x40, 0xa9,
+    0x97, 0x0f, 0xfb, 0x85, 0x65, 0x69, 0xf0, 0xde, 0x83, 0x65, 0x1b, 0x54, 0x24, 0x4b, 0x07, 0xe6,
+    0xf4, 0xb3, 0x78, 0x85, 0xa5, 0x89, 0xfb, 0x1c, 0xd7, 0xe9, 0x33, 0x65, 0xf4, 0x3f, 0x32, 0x37,
+    0x63, 0x76, 0x02, 0xd3, 0xff, 0xec, 0x09, 0xbb, 0x5b, 0x10, 0x97, 0xac, 0x42, 0x9f, 0x35, 0xea,
+    0xb2, 0x1e, 0xa9, 0x97, 0x8b, 0x46, 0x20, 0x28, 0xd1, 0x04, 0xff, 0x11, 0x30, 0xe7, 0x71, 0x58,
+    0x3a, 0xbd, 0x0a, 0x9b, 0xf7, 0xaa, 0x81, 0xc2, 0xc5, 0xfb, 0x27, 0xda, 0x58, 0x50, 0xc5, 0x50,
+    0x13, 0x79, 0x6e, 0xf1, 0x6e, 0x27, 0xd2, 0x83, 0x18, 0x14, 0x15, 0x1d, 0xab, 0x60, 0xcf, 0x68,
+    0x3a, 0x43, 0x63, 0xf8, 0x5b, 0x34, 0xe9, 0xc7, 0xb2, 0xe7, 0xca, 0xc6, 0x5c, 0x66, 0xc9, 0x92,
+    0x37, 0xdd, 0x1e, 0x52, 0x62, 0xc4, 0x2a, 0x1d, 0x9f, 0x6d, 0xc2, 0x0f, 0xb5, 0xdf, 0xa3, 0xc6,
+    0x5b, 0xd9, 0x72, 0xcb, 0xd8, 0x3a, 0xcf, 0x6e, 0xd5, 0x46, 0x5b, 0x39, 0x1f, 0x61, 0xc4, 0xb3,
+    0x09, 0x5b, 0x88, 0xee, 0x89, 0x32, 0x2b, 0xd1, 0x96, 0x8c, 0xb2, 0xe3, 0x52, 0x6f, 0xe6, 0x12,
+    0xf7, 0xdf, 0x25, 0xae, 0x09, 0xfa, 0x56, 0xa8, 0xf6, 0xff, 0xf6, 0x4d, 0x76, 0x2b, 0xb2, 0xd7,
+    0xef, 0x5b, 0x99, 0x7a, 0x3f, 0x06, 0x4a, 0xae, 0xdd, 0xb7, 0x54, 0x95, 0x7e, 0x0c, 0x57, 0x18,
+    0x02, 0xf0, 0x4c, 0xc5, 0x1f, 0x03, 0xa6, 0x2e, 0x02, 0x48, 0xaa, 0xda, 0x8f, 0x01, 0x0e, 0x97,
+    0xee, 0x41, 0x5a, 0xbf, 0x97, 0xed, 0x4b, 0x07, 0xe9, 0xed, 0x7c, 0xd7, 0x55, 0x4a, 0xcd, 0xe1,
+    0xcf, 0xce, 0x34, 0xea, 0xdd, 0xc8, 0x9c, 0x0a, 0xe3, 0x9d, 0x70, 0x43, 0xbc, 0x06, 0x9b, 0xcd,
+    0x59, 0xe7, 0x8f, 0x80, 0x37, 0x52, 0x74, 0x20, 0xe0, 0x3f, 0xee, 0x9d, 0xcc, 0xc8, 0x8b, 0x10,
+    0x2b, 0xcc, 0x57, 0x69, 0x34, 0x67, 0xf3, 0x6f, 0xf7, 0xe5, 0x3b, 0x69, 0x92, 0x7f, 0x1e, 0xf0,
+    0x35, 0x02, 0x15, 0xe1, 0xe9, 0xca, 0x43, 0xab, 0xfa, 0xac, 0x02, 0xeb, 0x4d, 0x5e, 0x6b, 0x34,
+    0x82, 0x9c, 0x5e, 0x9b, 0xaa, 0x64, 0xbf, 0x0a, 0xf6, 0x44, 0xf3, 0x07, 0xcc, 0xc9, 0x25, 0x15,
+    0xd6, 0x72, 0x4c, 0x26, 0x14, 0xbf, 0x61, 0xc1, 0x4c, 0x23, 0x9c, 0x62, 0x10, 0xfd, 0x0c, 0xd9,
+    0x8d, 0xd1, 0x31, 0xea, 0xa7, 0xa2, 0xb6, 0xca, 0x50, 0x5b, 0x47, 0x50, 0xe7, 0x6b, 0xa7, 0x1d,
+    0xff, 0x62, 0x89, 0xd7, 0x1e, 0x14, 0x51, 0x45, 0x9b, 0xd6, 0xc8, 0x32, 0xbd, 0xcf, 0xa4, 0xa6,
+    0xa7, 0x2c, 0xfd, 0x34, 0x71, 0xf1, 0x19, 0x0b, 0x51, 0x8f, 0x5d, 0x87, 0x9e, 0x82, 0xaf, 0x83,
+    0x87, 0xf0, 0xbe, 0x4e, 0xba, 0x37, 0x76, 0xa5, 0x68, 0x77, 0xa5, 0xe3, 0x4a, 0xa9, 0x6d, 0x6a,
+    0xe9, 0x11, 0xf7, 0x83, 0x4a, 0x4a, 0x20, 0x17, 0x7e, 0x79, 0x03, 0x03, 0x3c, 0x28, 0x12, 0x8f,
+    0x40, 0xa4, 0x5e, 0xb9, 0x74, 0xf5, 0x19, 0x62, 0x22, 0xb8, 0x9f, 0xb2, 0x00, 0x8a, 0x3d, 0x50,
+    0x20, 0x51, 0x05, 0xf4, 0x52, 0x0a, 0xe1, 0x73, 0x45, 0x22, 0x0b, 0x42, 0x3b, 0x9d, 0x54, 0xa1,
+    0x4d, 0x19, 0xf4, 0x32, 0xc8, 0xe2, 0x94, 0xa0, 0x70, 0x19, 0x36, 0xd6, 0x31, 0x64, 0xe4, 0x26,
+    0x9a, 0x28, 0x01, 0x7e, 0x32, 0xd5, 0x5b, 0xc4, 0x21, 0x28, 0x09, 0xc0, 0x45, 0xd9, 0x4e, 0x77,
+    0x54, 0x38, 0x95, 0x64, 0x23, 0x6e, 0x0d, 0xe6, 0xee, 0x2e, 0x0c, 0xf2, 0xe1, 0xe2, 0x29, 0xe0,
+    0x3b, 0x48, 0xa8, 0x38, 0xf2, 0x33, 0x32, 0x50, 0xe1, 0x01, 0xb5, 0xac, 0x24, 0xf4, 0x53, 0xeb,
+    0xdd, 0xec, 0xd5, 0x2e, 0xc3, 0x34, 0x90, 0x9d, 0xa1, 0xfc, 0x08, 0x94, 0x44, 0x84, 0x3d, 0x8a,
+    0x18, 0x21, 0xa7, 0xfc, 0xb4, 0x21, 0x68, 0xe9, 0x63, 0xc6, 0x8f, 0x13, 0x82, 0x0d, 0x09, 0x10,
+    0xec, 0x01, 0x51, 0x3b, 0xfd, 0x16, 0x76, 0x03, 0x44, 0xc3, 0xa8, 0x31, 0x16, 0xa0, 0x06, 0xf6,
+    0x6c, 0x44, 0x6e, 0x20, 0x7b, 0x81, 0xb4, 0x66, 0xbf, 0x73, 0x09, 0x94, 0xb0, 0x79, 0x74, 0x01,
+    0x81, 0x8c, 0xc7, 0x0e, 0x10, 0xf6, 0xee, 0x6e, 0xf1, 0x5d, 0xf3, 0x0a, 0x09, 0xc9, 0x2f, 0xfc,
+    0x3d, 0x5b, 0x11, 0xa0, 0x0d, 0x06, 0x3d, 0xc8, 0x7b, 0x02, 0xb4, 0xbc, 0x03, 0xcc, 0xfc, 0x98,
+    0xa2, 0x83, 0x3e, 0xc0, 0x8e, 0x46, 0xbd, 0x35, 0xe4, 0x29, 0x79, 0x64, 0xbe, 0xe7, 0xde, 0x89,
+    0x3c, 0x14, 0xc3, 0xfe, 0xea, 0xdf, 0x06, 0x84, 0x21, 0xb0, 0xa3, 0x8d, 0xbf, 0x87, 0x9c, 0x2f,
+    0xec, 0x3c, 0xc9, 0xe7, 0x49, 0xd1, 0x99, 0x41, 0x6a, 0x45, 0x7d, 0x06, 0xcc, 0x1f, 0xdb, 0x01,
+    0x32, 0x66, 0xb0, 0x2b, 0xdf, 0xa6, 0x69, 0xe4, 0xee, 0x2b, 0x86, 0x94, 0xb5, 0xb2, 0x18, 0x51,
+    0xd8, 0x93, 0xdc, 0x73, 0x5b, 0x88, 0x70, 0x73, 0x4a, 0xed, 0x77, 0xff, 0xb6, 0x78, 0xff, 0xae,
+    0x23, 0xc2, 0x64, 0x83, 0x74, 0x6c, 0x1c, 0xe2, 0x66, 0x3e, 0x3a, 0xde, 0x43, 0x01, 0x1b, 0x10,
+    0xd5, 0xb9, 0x85, 0xd8, 0xe7, 0x95, 0x31, 0xf8, 0x35, 0x3f, 0x7a, 0xbb, 0xc1, 0x6e, 0x83, 0xc3,
+    0xb4, 0xf8, 0x0d, 0x8f, 0x86, 0xb6, 0x67, 0x10, 0x05, 0xbe, 0x69, 0x37, 0x3e, 0x60, 0x99, 0x76,
+    0xe5, 0xf7, 0x0b, 0x4d, 0xf9, 0xd7, 0x6e, 0x44, 0x87, 0x2f, 0xf2, 0x1b, 0x17, 0x92, 0xc3, 0x97,
+    0xa9, 0x4d, 0x6f, 0x90, 0xc8, 0x08, 0x67, 0x35, 0xf1, 0xa4, 0x7d, 0x6d, 0x9e, 0x41, 0x3f, 0xdd,
+    0x98, 0x73, 0xf4, 0x89, 0x60, 0xf9, 0x55, 0x41, 0x0b, 0x50, 0x1e, 0xd8, 0xc2, 0x1b, 0x82, 0x1d,
+    0x24, 0x2d, 0x14, 0x96, 0x03, 0x88, 0xdc, 0x14, 0x6b, 0x8e, 0x7e, 0xa3, 0x0c, 0xd2, 0xde, 0x20,
+    0x28, 0x7c, 0xbb, 0x10, 0x0c, 0x26, 0x8b, 0x77, 0x61, 0xf5, 0x88, 0xb0, 0x6e, 0x9a, 0xb2, 0x29,
+    0x7f, 0x06, 0x78, 0x8e, 0x94, 0x54, 0x46, 0x8f, 0x73, 0xe7, 0xe9, 0x4c, 0x41, 0xa4, 0x1f, 0x32,
+    0xcb, 0x81, 0xe5, 0x41, 0x97, 0xfe, 0x97, 0x1a, 0xa2, 0x36, 0xbc, 0x89, 0x0f, 0xe6, 0x6a, 0x73,
+    0x75, 0x2b, 0x63, 0x2a, 0x13, 0x7b, 0x30, 0xd1, 0x59, 0x2d, 0xde, 0x3a, 0x6a, 0xb9, 0x15, 0xdf,
+    0x70, 0x10, 0x40, 0xf0, 0x72, 0x4b, 0xd8, 0x9a, 0x78, 0xab, 0x3b, 0xf4, 0x1e, 0x5c, 0x08, 0xe4,
+    0xc4, 0xc5, 0x24, 0xe6, 0xcf, 0xd5, 0xb8, 0xe5, 0xea, 0x82, 0x90, 0x02, 0xee, 0xf4, 0xbd, 0xfb,
+    0x48, 0x8c, 0xd6, 0x50, 0xba, 0x23, 0x3c, 0xab, 0x89, 0x76, 0x70, 0x0d, 0xcd, 0xa7, 0x5d, 0x09,
+    0xab, 0x60, 0x39, 0x11, 0x74, 0xd9, 0xa5, 0x94, 0x60, 0x52, 0xf7, 0xf7, 0x1f, 0x11, 0x61, 0x39,
+    0xa4, 0x34, 0x88, 0xfe, 0x7c, 0x71, 0x17, 0xc8, 0x1b, 0xde, 0x5f, 0x31, 0x88, 0x27, 0x68, 0x3c,
+    0x06, 0x85, 0xf7, 0x35, 0xe0, 0x19, 0xe4, 0x42, 0x25, 0xda, 0x8a, 0x66, 0xba, 0x19, 0xcc, 0xfb,
+    0x63, 0x6b, 0xd0, 0xeb, 0x8d, 0x7b, 0x10, 0x3f, 0x5f, 0x07, 0x5c, 0xc8, 0x20, 0xa7, 0x5f, 0x30,
+    0xa8, 0x03, 0x7b, 0xb0, 0xc8, 0xe0, 0xd8, 0xe4, 0x5e, 0x7f, 0x78, 0x79, 0x69, 0xc1, 0x64, 0x30,
+    0x68, 0x82, 0xde, 0xae, 0x7e, 0xdb, 0x50, 0x06, 0x4e, 0x57, 0x61, 0xea, 0x68, 0x3c, 0x36, 0xfb,
+    0x03, 0xbe, 0xee, 0x3b, 0xba, 0xda, 0xc0, 0x7a, 0x01, 0x12, 0xad, 0x2b, 0x88, 0x5a, 0x01, 0xa9,
+    0xb2, 0xb4, 0x31, 0xea, 0x9b, 0x06, 0xdf, 0x67, 0x3f, 0xd2, 0xcf, 0x34, 0xc4, 0x68, 0xb1, 0xa1,
+    0x6e, 0x95, 0x75, 0x47, 0xd6, 0xa8, 0xd7, 0xe3, 0x1b, 0xd0, 0xf3, 0x0d, 0xa3, 0xfc, 0x31, 0x92,
+    0x0d, 0x84, 0x4b, 0xb0, 0x8c, 0xcf, 0x95, 0x38, 0x1e, 0x8d, 0xcc, 0xde, 0xd0, 0xe2, 0x64, 0x3f,
+    0xa3, 0x36, 0xf6, 0xc0, 0x55, 0x21, 0x28, 0xe3, 0x6d, 0x50, 0x85, 0x62, 0x6b, 0x34, 0x18, 0x8d,
+    0xc6, 0x7c, 0x65, 0xec, 0x92, 0x25, 0xac, 0x4f, 0x6e, 0xf5, 0xd3, 0x14, 0x26, 0x56, 0x76, 0xf9,
+    0x74, 0x9b, 0x0a, 0xd9, 0x7e, 0x15, 0xee, 0xc1, 0x0d, 0x62, 0xb3, 0x1a, 0xf5, 0x1e, 0xd1, 0xac,
+    0x46, 0xd6, 0x78, 0x68, 0x5c, 0x72, 0xf5, 0x3c, 0xb3, 0x21, 0xfe, 0xbd, 0xc5, 0x2e, 0x38, 0x73,
+    0x15, 0x01, 0x0f, 0x7b, 0xa3, 0xc1, 0xa5, 0x75, 0x09, 0x13, 0x7f, 0xc5, 0x0c, 0x76, 0xd0, 0xff,
+    0x00, 0x59, 0x55, 0xb3, 0xc4, 0xd1, 0x60, 0xcc, 0x2d, 0xf1, 0xad, 0xbf, 0xc1, 0xdb, 0x2d, 0xb6,
+    0x61, 0x3e, 0xc4, 0x8e, 0x4a, 0xa6, 0xd8, 0x37, 0xc6, 0xfd, 0xc1, 0x90, 0x5b, 0x31, 0xa6, 0x2e,
+    0xb9, 0x43, 0xff, 0x4e, 0xaa, 0x2c, 0x39, 0x1a, 0x0e, 0x87, 0x7d, 0xd3, 0x8a, 0x59, 0xfc, 0xb8,
+    0xa7, 0x5f, 0xd1, 0x0b, 0x8a, 0xbf, 0x56, 0x62, 0x72, 0x3c, 0x1a, 0x5f, 0x8e, 0x38, 0xb5, 0x60,
+    0xfc, 0x18, 0x42, 0xe3, 0x2f, 0x84, 0xb9, 0x78, 0x1f, 0xfa, 0x95, 0x2c, 0xff, 0x72, 0x38, 0xbc,
+    0x1c, 0x08, 0x09, 0x05, 0xd8, 0xdb, 0x7f, 0xfd, 0x8a, 0xb7, 0x60, 0x89, 0x8b, 0x8d, 0x4f, 0x96,
+    0x8f, 0x61, 0x4f, 0xb9, 0x4b, 0xf9, 0x8f, 0x29, 0x4b, 0x38, 0x7c, 0xd9, 0x44, 0x7e, 0x3f, 0x89,
+    0xbf, 0x02, 0x21, 0xd9, 0x1c, 0x82, 0x23, 0x81, 0x50, 0x3c, 0xf0, 0x5a, 0x3b, 0x6e, 0x7c, 0xe9,
+    0x47, 0xbf, 0x4b, 0x6d, 0xb0, 0x37, 0x7f, 0x2b, 0xbe, 0x73, 0x27, 0xde, 0x43, 0xb9, 0x87, 0xf6,
+    0x4a, 0x26, 0x54, 0xdf, 0x02, 0x1f, 0xbe, 0x1d, 0xea, 0xb6, 0xc6, 0x6c, 0xad, 0xa0, 0xdb, 0x20,
+    0x93, 0xe2, 0xae, 0x7c, 0x63, 0xd4, 0x6d, 0x92, 0x9a, 0x55, 0x32, 0x5b, 0xa5, 0xef, 0x38, 0xba,
+    0x8d, 0xf2, 0xb0, 0xb4, 0x6e, 0xbf, 0xac, 0x60, 0x75, 0xdf, 0x4f, 0x84, 0x85, 0x92, 0x41, 0x27,
+    0xc5, 0x67, 0x11, 0x60, 0x92, 0x8a, 0x9d, 0x21, 0x4a, 0xfd, 0x6a, 0x27, 0x48, 0x13, 0x76, 0x90,
+    0xc7, 0x91, 0x66, 0xc9, 0x70, 0xd9, 0x50, 0x3a, 0x3d, 0x3c, 0x3c, 0x68, 0x7f, 0xc4, 0xb7, 0x16,
+    0xc4, 0x0b, 0x7c, 0x26, 0x4d, 0xe1, 0x04, 0xcf, 0x3a, 0xe8, 0x37, 0x7e, 0x8c, 0xb9, 0x82, 0x7b,
+    0xcd, 0x2b, 0xea, 0x7f, 0x8e, 0x3e, 0xf0, 0x26, 0x97, 0xe8, 0xaa, 0x47, 0xe4, 0x55, 0xd7, 0x29,
+    0xa7, 0x91, 0xd3, 0x95, 0xed, 0x93, 0xd5, 0x32, 0x72, 0xe1, 0x97, 0x6b, 0xf3, 0x77, 0x7e, 0x88,
+    0x5e, 0x90, 0x10, 0x02, 0x1c, 0xb1, 0xab, 0x58, 0x77, 0x35, 0x07, 0xa8, 0xce, 0xe4, 0xdf, 0xdd,
+    0x90, 0xe1, 0x05, 0xef, 0x62, 0x9d, 0xcf, 0x65, 0xd2, 0xb3, 0x7b, 0x04, 0x0e, 0x0f, 0x2c, 0x44,
+    0xe4, 0x98, 0x13, 0x88, 0xff, 0x10, 0xce, 0x93, 0x95, 0x44, 0x27, 0x0f, 0x5c, 0xce, 0xe8, 0x18,
+    0x50, 0x5f, 0xc1, 0xd0, 0x1c, 0xad, 0xb6, 0x67, 0x60, 0xb6, 0x0a, 0x98, 0xad, 0x33, 0x31, 0x3f,
+    0xba, 0x23, 0x55, 0x48, 0xcb, 0x12, 0xdf, 0x8a, 0x7b, 0xe6, 0xda, 0xec, 0xac, 0x37, 0x8f, 0xda,
+    0x8f, 0x48, 0x66, 0xfe, 0xb2, 0xfe, 0xd3, 0xbb, 0x59, 0x61, 0x99, 0x63, 0x5b, 0x57, 0xa6, 0x70,
+    0x4d, 0x75, 0x34, 0x4f, 0xd8, 0xed, 0x6e, 0x85, 0xad, 0x54, 0xb7, 0xb9, 0xe4, 0x36, 0xba, 0x83,
+    0xcd, 0x89, 0x67, 0xe6, 0xc4, 0x41, 0x87, 0x5d, 0x43, 0x10, 0x9a, 0x09, 0xe4, 0x96, 0xdb, 0x75,
+    0x14, 0x29, 0x85, 0x4d, 0xcf, 0x6a, 0x1f, 0x89, 0x7d, 0x38, 0x92, 0xae, 0xcd, 0x1f, 0xcf, 0xe1,
+    0xce, 0x65, 0x23, 0x73, 0x3b, 0x5f, 0x8e, 0x13, 0xc7, 0x89, 0x6e, 0x07, 0xd4, 0x72, 0x23, 0xcf,
+    0xe9, 0xff, 0x54, 0x0c, 0xa5, 0x6f, 0x2f, 0x2c, 0xf2, 0x23, 0x46, 0xb5, 0xec, 0x88, 0x82, 0xed,
+    0x51, 0xb9, 0x79, 0x14, 0xcf, 0x83, 0x50, 0x20, 0xf3, 0xcf, 0x92, 0xac, 0x54, 0x7e, 0x9d, 0x54,
+    0xad, 0xaa, 0xcb, 0x96, 0xb8, 0x6a, 0x94, 0x3f, 0xc8, 0xac, 0xe8, 0x54, 0x47, 0xe5, 0x0f, 0x15,
+    0x1c, 0xf3, 0xd3, 0x03, 0xb9, 0x6d, 0xb3, 0x18, 0xae, 0xa5, 0xdc, 0x37, 0xfd, 0xcc, 0x80, 0xb8,
+    0xf8, 0x86, 0x77, 0x3f, 0x79, 0x04, 0x87, 0x9a, 0xee, 0x98, 0xd4, 0xb3, 0xcb, 0x58, 0xaa, 0x65,
+    0x20, 0x85, 0x51, 0xac, 0xc3, 0xaf, 0x7e, 0x60, 0x84, 0x3f, 0xe5, 0x89, 0x3e, 0xf2, 0x46, 0xec,
+    0x19, 0xcb, 0xf5, 0x4e, 0x5b, 0x8e, 0x2f, 0x43, 0xbd, 0xf5, 0x19, 0x0b, 0x8d, 0x4e, 0x5b, 0x28,
+    0x69, 0x44, 0x09, 0x51, 0x9e, 0xb1, 0x60, 0xff, 0x74, 0xce, 0xce, 0x52, 0xd8, 0xe0, 0x3c, 0x85,
+    0x9d, 0xcb, 0xd6, 0xf0, 0xb4, 0xe5, 0xc4, 0x32, 0xe7, 0x69, 0x6c, 0x7c, 0xae, 0xc6, 0x0a, 0xb6,
+    0xf8, 0xf8, 0x21, 0x45, 0x42, 0x65, 0x1e, 0x77, 0x98, 0x76, 0x45, 0xeb, 0xf5, 0x49, 0x3a, 0xda,
+    0xa8, 0x2b, 0x67, 0x79, 0x42, 0x9f, 0xe4, 0xc2, 0xfb, 0x7c, 0x28, 0xd2, 0x1f, 0xd5, 0x1b, 0xd9,
+    0x43, 0x79, 0x43, 0x79, 0x04, 0x6f, 0xe4, 0x4e, 0xda, 0xcd, 0xcc, 0xb1, 0x7a, 0xaa, 0x82, 0xbc,
+    0x57, 0xf7, 0x93, 0x33, 0xc4, 0x4f, 0xe5, 0x77, 0xe7, 0xa5, 0x38, 0xd9, 0xcd, 0x0f, 0x5d, 0xed,
+    0xdf, 0xa8, 0x43, 0x0f, 0x7d, 0xea, 0xdf, 0xc8, 0xb2, 0x7d, 0x8d, 0xc1, 0x88, 0xd1, 0xab, 0xbf,
+    0xbf, 0x16, 0x27, 0x12, 0xcf, 0x3e, 0x40, 0xa5, 0xb5, 0xe2, 0xbd, 0xec, 0xd0, 0x17, 0x47, 0x26,
+    0x2f, 0x17, 0x1f, 0x7a, 0x16, 0x6f, 0x7b, 0x30, 0x3f, 0xaa, 0xc8, 0x5c, 0xc2, 0x04, 0xe8, 0xf3,
+    0xe4, 0xa3, 0x7f, 0x03, 0xbf, 0x82, 0xfd, 0x32, 0x90, 0x8d, 0x4f, 0xd0, 0xae, 0x9c, 0xfb, 0xee,
+    0xd5, 0x2b, 0xcb, 0x30, 0x8c, 0x6e, 0x0f, 0x7e, 0xa1, 0x05, 0xff, 0xfe, 0x1a, 0xf4, 0xd6, 0xb7,
+    0x21, 0xa3, 0x8a, 0x82, 0xf0, 0x0b, 0x12, 0xd0, 0xb5, 0xd7, 0x15, 0x98, 0xf6, 0x32, 0xd8, 0x7f,
+    0x60, 0xfe, 0x1f, 0xc0, 0xcc, 0xb4, 0xbb, 0x4b, 0xd1, 0x8f, 0xd1, 0x86, 0x11, 0x67, 0x56, 0xdb,
+    0x84, 0xe1, 0x2e, 0x98, 0x74, 0xbb, 0x6b, 0x1a, 0x6e, 0xf6, 0xcb, 0xce, 0xca, 0xdf, 0x76, 0x79,
+    0x57, 0xee, 0xbd, 0xf7, 0x69, 0x43, 0x83, 0x2e, 0xb1, 0x3e, 0xb7, 0x49, 0xef, 0x73, 0x3b, 0xa2,
+    0xa2, 0x86, 0x42, 0x0c, 0xe6, 0x15, 0xce, 0x6a, 0xff, 0xbd, 0x74, 0xb1, 0x07, 0xf9, 0xd5, 0x2b,
+    0x1a, 0xfe, 0xba, 0x5f, 0xa2, 0x8f, 0x44, 0x3c, 0x5a, 0xef, 0xb3, 0xbb, 0x69, 0x17, 0xc7, 0x12,
+    0x8c, 0x65, 0x06, 0x95, 0x9d, 0x38, 0x40, 0x00, 0x63, 0x14, 0xff, 0x1f, 0x83, 0xff, 0x05, 0x67,
+    0x5a, 0x3d, 0xdb, 0xd8, 0x60, 0x00, 0x00,
+};
+
+#endif
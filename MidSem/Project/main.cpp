@@ -10,22 +10,24 @@ TrafficModule traffic (Pin_TrafficRed, Pin_TrafficYellow, Pin_TrafficGreen);
 Sonic sonic1 (Pin_SonicTrigger_1, Pin_SonicEcho_1);
 Sonic sonic2 (Pin_SonicTrigger_2, Pin_SonicEcho_2);
 Motor motor (Pin_DIR1, Pin_DIR2, Pin_Enable);
+PhotoCell photoCell (Pin_PhotoCell);
 bool EStop = false;
 bool Manual = false;
 bool streetLightOn = false;
 bool ultrasonics = false;
-double sonic1Dist_cm = 0;
-double sonic2Dist_cm = 0;
+DistanceMM sonic1Dist;
+DistanceMM sonic2Dist;
 
 void setup(){
     Serial.begin(115200);
     traffic.init();
     webPage_init();
-    sonic1.init();
-    sonic2.init();
     motor.init();
     initPins();
     initInterrupts();
+    photoCell.init();
+    sensorTask_init();
+    loopStats.begin();
 
     currentState = lowered;
 }
@@ -48,47 +50,71 @@ void initPins() {
     pinMode(Pin_EStop, INPUT_PULLUP);
     pinMode(Pin_LS_Bottom, INPUT_PULLUP);
     pinMode(Pin_LS_Top, INPUT_PULLUP);
-    pinMode(Pin_PhotoCell, INPUT);
-    pinMode(Pin_Street, OUTPUT);
-    pinMode(Pin_Status, OUTPUT);
-    pinMode(Pin_Buzzer, OUTPUT);
-    pinMode(Pin_BoatLight, OUTPUT);
+    outputs.attach(Pin_Street);
+    outputs.attach(Pin_Status);
+    outputs.attach(Pin_Buzzer);
+    outputs.attach(Pin_BoatLight);
 }
 
 void loop() {
-
-
-    server.handleClient();
+    loopStats.passStart();
+    webPage_commands();     // the web server itself runs in its own task
+    loopStats.mark(Phase_Web);
     sonics();
+    loopStats.mark(Phase_Sonics);
     stateMachine(currentState);
+    loopStats.mark(Phase_State);
     streetLights();
+    loopStats.mark(Phase_Street);
+    outputs.commit();   // the only place this pass's outputs reach the pins
+    loopStats.mark(Phase_Commit);
+    webPage_publish(millis());      // after commit, so the page never runs ahead of the pins
+    loopStats.mark(Phase_Push);
+    loopStats.passEnd();
+
+    serialCommands();   // outside the pass, so printing stats doesn't skew them
     // Serial.print("LS1: " + (String)!digitalRead(Pin_LS_Bottom) + " , ");
     // Serial.println("LS2: " + (String)!digitalRead(Pin_LS_Top));
 
 }
 
-int lightLevelSamples = 20;
-
+// Readings come from the acquisition task on the other core; this only
+// drains its ring, so it never waits on a ping.
 void sonics() {
-  sonic1Dist_cm = sonic1.poll_cm(); 
-  sonic2Dist_cm = sonic2.poll_cm(); 
-  Serial.println("Dist: " + (String)sonic1Dist_cm + " - " + (String)sonic2Dist_cm); 
-  ultrasonics = sonic1Dist_cm < detection_distance || sonic2Dist_cm < detection_distance;
+  SensorSample sample;
+  if (!sensorTask_drain(sample)) return;
+  sonic1Dist = sample.sonic[0]; 
+  sonic2Dist = sample.sonic[1]; 
+  // A sensor only counts once its filter is confident; this replaces the old
+  // "see it 4 times in a row" debounce in the state machine.
+  ultrasonics = false;
+  for (uint8_t i = 0; i < sample.count; i++) {
+    if (sample.confidence[i] >= Sonic_MinConfidence && sample.sonic[i] < detection_distance) ultrasonics = true;
+  }
 }
 
-void streetLights() {
-    int lightLevel = 0;
-    for (int i=0; i < lightLevelSamples; i++)
-    {
-        lightLevel += analogRead(Pin_PhotoCell);
+// "stats" prints the loop phase timings and the latest distances, "stats
+// reset" clears the timings
+void serialCommands() {
+    if (!Serial.available()) return;
+    String command = Serial.readStringUntil('\n');
+    command.trim();
+    if (command == "stats") {
+        loopStats.print();
+        Serial.print("Dist: "); Serial.print(sonic1Dist.mm()); Serial.print(" - "); Serial.print(sonic2Dist.mm()); Serial.println(" mm");
+    } else if (command == "stats reset") {
+        loopStats.reset();
+        Serial.println("Loop stats cleared");
     }
-    lightLevel /= lightLevelSamples;
+}
 
-    bool temp = (lightLevel >= 1300) ? LOW : HIGH;
+// The photocell is sampled and smoothed on the sensor task; this just
+// mirrors its decision onto the street light pin.
+void streetLights() {
+    bool temp = photoCell.dark() ? HIGH : LOW;
     if (temp != streetLightOn) {
         streetLightOn = temp;
-        digitalWrite(Pin_Street, temp);
-        // Serial.println("StreetLight change: " + (String)temp + " , " + (String) lightLevel);
+        outputs.set(Pin_Street, temp);
+        // Serial.println("StreetLight change: " + (String)temp + " , " + (String) photoCell.level());
     }
-    // Serial.println(lightLevel);
 }
\ No newline at end of file
@@ -8,6 +8,10 @@
 #include "DCMotor.h"
 #include "SonicSensor.h"
 #include "TrafficLight.h"
+#include "SensorTask.h"
+#include "PhotoCell.h"
+#include "GpioShadow.h"
+#include "LoopStats.h"
 
 
 #define Pin_Enable           5
@@ -33,7 +37,7 @@
 #define MotorSpeed_Fast 
 #define MotorSpeed_Slow
 
-#define WebServer_PollingRate   1000 //ms
+#define WebServer_Port          80
 #define WebServer_SSID          "ESP32WA8"
 #define WebServer_Password      "12345678"
 
@@ -41,20 +45,22 @@ extern TrafficModule traffic;
 extern Sonic sonic1;
 extern Sonic sonic2;
 extern Motor motor ;
+extern PhotoCell photoCell;
 void initPins();
 void disableMotor();
 void initInterrupts();
 void streetLights();
 void sonics();
+void serialCommands();
 extern bridgeState currentState;
 extern bool Manual;
 extern bool EStop;
 extern bool streetLightOn;
 extern bool ultrasonics;
-extern double sonic1Dist_cm;
-extern double sonic2Dist_cm;
+extern DistanceMM sonic1Dist;
+extern DistanceMM sonic2Dist;
 
-const int detection_distance = 30;
+const DistanceMM detection_distance = 30_cm;
 
 
 #endif
\ No newline at end of file
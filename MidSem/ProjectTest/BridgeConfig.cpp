@@ -64,7 +64,7 @@
  * TIMING PARAMETERS (milliseconds):
  * - actionDelay: State transition delay (100-60000ms)
  * - moveTimeout: Motor operation safety timeout (1000-120000ms)
- * - emergencyDelay: Emergency operation duration (500-10000ms)
+ * - emergencyDelay: Pause before reversing the motor in an emergency (500-10000ms)
  * - debugLogInterval: Sensor logging frequency (1000-300000ms)
  * 
  * DISTANCE PARAMETERS (centimeters):
@@ -190,7 +190,7 @@ void BridgeConfigManager::resetToDefaults() {
   // Set default timing values (milliseconds)
   config.actionDelay = 3000;        // 3 seconds wait before state transitions
   config.moveTimeout = 8000;        // 8 seconds safety timeout
-  config.emergencyDelay = 2000;     // 2 seconds for emergency operations
+  config.emergencyDelay = 500;      // 0.5 seconds stopped before an emergency reversal
   config.debugLogInterval = 10000;  // 10 seconds between sensor logs
   
   // Set default distance thresholds (centimeters)
@@ -251,7 +251,7 @@ void BridgeConfigManager::printConfigMenu() {
   Serial.println(F("Timing (ms):"));
   Serial.println(F("  action_delay=<value>     - Set state transition delay"));
   Serial.println(F("  move_timeout=<value>     - Set motor operation timeout"));
-  Serial.println(F("  emergency_delay=<value>  - Set emergency operation duration"));
+  Serial.println(F("  emergency_delay=<value>  - Set pause before emergency reversal"));
   Serial.println(F("  debug_interval=<value>   - Set sensor logging interval"));
   Serial.println(F("\nDistances (cm):"));
   Serial.println(F("  boat_detect=<value>      - Set boat detection distance"));
@@ -271,6 +271,7 @@ void BridgeConfigManager::printConfigMenu() {
   Serial.println(F("  save                     - Save configuration to EEPROM"));
   Serial.println(F("  reset                    - Reset to default values"));
   Serial.println(F("  show                     - Display current configuration"));
+  Serial.println(F("  journal                  - Dump the input journal (hex)"));
   Serial.println(F("  help                     - Show this menu"));
   Serial.println(F("===============================\n"));
 }
@@ -366,7 +367,7 @@ bool BridgeConfigManager::processConfigCommand(String command) {
     else if (param == "sonic_min") {
       uint16_t val = value.toInt();
       if (val >= 1 && val <= 50) {
-        setSonicRange(val, getSonicMaxRange());
+        setSonicRange(val, config.sonicSensorMaxRange);
         Serial.print(F("Sonic minimum range set to: ")); Serial.println(val);
         return true;
       }
@@ -374,7 +375,7 @@ bool BridgeConfigManager::processConfigCommand(String command) {
     else if (param == "sonic_max") {
       uint16_t val = value.toInt();
       if (val >= 100 && val <= 1000) {
-        setSonicRange(getSonicMinRange(), val);
+        setSonicRange(config.sonicSensorMinRange, val);
         Serial.print(F("Sonic maximum range set to: ")); Serial.println(val);
         return true;
       }
@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include <EEPROM.h>
+#include "Units.h"
 
 // EEPROM Configuration Structure
 struct BridgeConfig {
@@ -12,7 +13,7 @@ struct BridgeConfig {
   // Timing constants (milliseconds)
   uint32_t actionDelay;        // Wait time before state transitions
   uint32_t moveTimeout;        // Safety timeout for motor operations
-  uint32_t emergencyDelay;     // Duration for emergency operations
+  uint32_t emergencyDelay;     // Motor-off pause before an emergency reversal
   uint32_t debugLogInterval;   // Periodic sensor logging interval
   
   // Distance thresholds (centimeters)
@@ -60,16 +61,21 @@ public:
   // Reset to default values
   void resetToDefaults();
   
+  // Whole configuration, for the input journal and its replay
+  const BridgeConfig& getConfig() const { return config; }
+  void setConfig(const BridgeConfig& c) { config = c; }
+
   // Getters for configuration values
   uint32_t getActionDelay() const { return config.actionDelay; }
   uint32_t getMoveTimeout() const { return config.moveTimeout; }
   uint32_t getEmergencyDelay() const { return config.emergencyDelay; }
   uint32_t getDebugLogInterval() const { return config.debugLogInterval; }
   
-  uint16_t getBoatDetectionDistance() const { return config.boatDetectionDistance; }
-  uint16_t getAreaClearDistance() const { return config.areaClearDistance; }
-  uint16_t getSonicMinRange() const { return config.sonicSensorMinRange; }
-  uint16_t getSonicMaxRange() const { return config.sonicSensorMaxRange; }
+  // Distances are stored in cm but handed out as fixed-point mm
+  DistanceMM getBoatDetectionDistance() const { return DistanceMM::fromCm(config.boatDetectionDistance); }
+  DistanceMM getAreaClearDistance() const { return DistanceMM::fromCm(config.areaClearDistance); }
+  DistanceMM getSonicMinRange() const { return DistanceMM::fromCm(config.sonicSensorMinRange); }
+  DistanceMM getSonicMaxRange() const { return DistanceMM::fromCm(config.sonicSensorMaxRange); }
   
   uint8_t getMotorSpeedFast() const { return config.motorSpeedFast; }
   uint8_t getMotorSpeedSlow() const { return config.motorSpeedSlow; }
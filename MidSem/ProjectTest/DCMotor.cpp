@@ -3,6 +3,7 @@
 Motor::Motor(uint8_t drive, uint8_t dir) {
     DrivePin = drive;
     DirectionPin = dir;
+    lastDrive = 0;
 }
 
 void Motor::init() {
@@ -10,12 +11,18 @@ void Motor::init() {
     pinMode(DirectionPin, OUTPUT);
 }
 
+// The driver takes a direction and a PWM duty (see run()), so zero duty is
+// stopped whichever way DirectionPin is set. Copying DirectionPin onto
+// DrivePin would brake an IN1/IN2 driver, but on this one it is full speed
+// whenever the last run was direction 1.
 void Motor::disable()
 {
-    digitalWrite(DrivePin, digitalRead(DirectionPin));
+    analogWrite(DrivePin, 0);
+    lastDrive = 0;
 }
 
 void Motor::run (int pwm, int direction) {
     digitalWrite( DirectionPin , ((direction==1)?HIGH:LOW) );
     analogWrite( DrivePin, pwm );
+    lastDrive = pwm;
 }
\ No newline at end of file
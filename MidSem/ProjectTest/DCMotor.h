@@ -7,11 +7,13 @@ class Motor {
     private:
         uint8_t DrivePin;
         uint8_t DirectionPin;
+        uint8_t lastDrive;      // duty last put on DrivePin
     public:
         Motor(uint8_t drive, uint8_t dir);
         void init();
         void disable();
         void run(int pwm, int direction);
+        uint8_t drive() const { return lastDrive; }
 };
 
 #endif
\ No newline at end of file
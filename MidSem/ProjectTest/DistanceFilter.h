@@ -0,0 +1,110 @@
+#ifndef DISTANCEFILTER_H
+#define DISTANCEFILTER_H
+
+#include <stdint.h>
+#include "Units.h"
+
+// Streaming filter stage that sits after a distance sensor:
+//   1. range gate   - readings below minVal (blind zone) are rejected; no echo
+//                     (0) or anything past maxVal is taken as maxVal, "nothing
+//                     in range", so open water reads far instead of freezing
+//                     on the last thing seen
+//   2. median       - sliding window of the last W accepted readings
+//   3. confidence   - 0..100, how many recent readings were in range and agree
+//                     with the median (within +/- tolerance)
+// Integer only, no heap, and every push() costs at most O(W) for a fixed W,
+// so it is safe to run once per echo. Works in DistanceMM (integer mm).
+template <uint8_t W>
+class DistanceFilter {
+    static_assert(W >= 3 && W <= 31 && (W & 1), "DistanceFilter window must be odd, 3..31");
+    private:
+        uint16_t minVal;
+        uint16_t maxVal;
+        uint16_t tolerance;
+        uint16_t window[W];     // accepted readings, oldest at `oldest`
+        uint16_t sorted[W];     // same readings kept in ascending order
+        uint8_t  count;         // readings held (<= W)
+        uint8_t  oldest;
+        uint32_t history;       // last W push() results, 1 = accepted
+
+        uint8_t acceptedRecently() const {
+            uint32_t h = history & ((1UL << W) - 1);
+            uint8_t n = 0;
+            while (h) { h &= h - 1; n++; }
+            return n;
+        }
+    public:
+        DistanceFilter() {
+            minVal = 0;
+            maxVal = 0xFFFF;
+            tolerance = 0;
+            reset();
+        }
+
+        DistanceFilter(DistanceMM minV, DistanceMM maxV, DistanceMM tol) {
+            minVal = minV.mm();
+            maxVal = maxV.mm();
+            tolerance = tol.mm();
+            reset();
+        }
+
+        void reset() {
+            count = 0;
+            oldest = 0;
+            history = 0;
+        }
+
+        void setRange(DistanceMM minV, DistanceMM maxV) { minVal = minV.mm(); maxVal = maxV.mm(); }
+        void setTolerance(DistanceMM tol) { tolerance = tol.mm(); }
+
+        // Feed one raw reading. Returns false if the range gate rejected it.
+        bool push(DistanceMM reading) {
+            uint16_t raw = reading.mm();
+            if (raw == 0 || raw > maxVal) raw = maxVal;
+            bool inRange = raw >= minVal;
+            history = (history << 1) | (inRange ? 1 : 0);
+            if (!inRange) return false;
+
+            uint8_t pos;
+            if (count < W) {
+                window[count] = raw;
+                pos = count++;
+            } else {
+                // drop the oldest reading from the sorted copy
+                uint16_t out = window[oldest];
+                window[oldest] = raw;
+                oldest = (oldest + 1) % W;
+                uint8_t i = 0;
+                while (sorted[i] != out) i++;
+                for (; i + 1 < W; i++) sorted[i] = sorted[i + 1];
+                pos = W - 1;
+            }
+            // insertion into the sorted copy
+            while (pos > 0 && sorted[pos - 1] > raw) {
+                sorted[pos] = sorted[pos - 1];
+                pos--;
+            }
+            sorted[pos] = raw;
+            return true;
+        }
+
+        bool empty() const { return count == 0; }
+
+        // Median of the accepted window (0 before the first accepted reading).
+        DistanceMM median() const { return DistanceMM(count ? sorted[count / 2] : 0); }
+
+        uint8_t confidence() const {
+            if (count == 0) return 0;
+            uint16_t m = median().mm();
+            uint8_t agree = 0;
+            for (uint8_t i = 0; i < count; i++) {
+                uint16_t d = sorted[i] > m ? sorted[i] - m : m - sorted[i];
+                if (d <= tolerance) agree++;
+            }
+            return (uint8_t)((uint16_t)acceptedRecently() * agree * 100 / (W * W));
+        }
+
+        bool valid(uint8_t minConfidence = 50) const { return confidence() >= minConfidence; }
+};
+
+#endif
@@ -0,0 +1,78 @@
+#include "EchoCapture.h"
+
+EchoCapture::EchoCapture(uint8_t trig, uint8_t echo, uint32_t timeout) {
+    trigPin = trig;
+    echoPin = echo;
+    timeoutUs = timeout;
+    inFlight = false;
+    trigAt = 0;
+    riseAt = 0;
+    seq = 0;
+    width = 0;
+    stamp = 0;
+    count = 0;
+}
+
+void EchoCapture::init() {
+    pinMode(trigPin, OUTPUT);
+    pinMode(echoPin, INPUT);
+    digitalWrite(trigPin, LOW);
+    attachInterruptArg(digitalPinToInterrupt(echoPin), echoISR, this, CHANGE);
+}
+
+// Fire a ping and return straight away. Refuses while the previous echo is
+// still in flight so two pings never overlap on the same sensor.
+bool EchoCapture::trigger() {
+    if (busy()) return false;
+    riseAt = 0;
+    inFlight = true;
+    digitalWrite(trigPin, HIGH);
+    delayMicroseconds(10);
+    digitalWrite(trigPin, LOW);
+    trigAt = micros();
+    return true;
+}
+
+// A sensor that never raises its echo line would otherwise block re-triggering
+// forever, so give up on the ping after the timeout (plus the HC-SR04's own
+// ~38ms no-echo pulse).
+bool EchoCapture::busy() {
+    if (inFlight && (micros() - trigAt) > timeoutUs + 40000UL) {
+        inFlight = false;
+    }
+    return inFlight;
+}
+
+bool EchoCapture::latest(EchoSample& out) const {
+    uint32_t s;
+    do {
+        s = seq;
+        out.widthUs = width;
+        out.stampUs = stamp;
+        out.count   = count;
+    } while ((s & 1) || s != seq);
+    if (out.widthUs >= timeoutUs) out.widthUs = 0;
+    return out.count != 0;
+}
+
+uint32_t EchoCapture::widthUs() const {
+    EchoSample s;
+    latest(s);
+    return s.widthUs;
+}
+
+void IRAM_ATTR EchoCapture::echoISR(void* arg) {
+    EchoCapture* self = (EchoCapture*)arg;
+    uint32_t now = micros();
+    if (digitalRead(self->echoPin)) {   // Gone HIGH
+        self->riseAt = now;
+    } else if (self->riseAt != 0) {     // Gone LOW
+        self->seq = self->seq + 1;
+        self->width = now - self->riseAt;
+        self->stamp = now;
+        self->count = self->count + 1;
+        self->seq = self->seq + 1;
+        self->riseAt = 0;
+        self->inFlight = false;
+    }
+}
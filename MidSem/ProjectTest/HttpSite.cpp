@@ -0,0 +1,26 @@
+#include "HttpTask.h"
+
+const HttpRoute httpRoutes[] = {
+    { "/",                      Http_Page,      Http_NoCommand },
+    { "/state",                 Http_State,     Http_NoCommand },
+    { "/events",                Http_Events,    Http_NoCommand },
+    { "/eStop/on",              Http_Command,   Web_EStopOn },
+    { "/eStop/off",             Http_Command,   Web_EStopOff },
+    { "/debug/on",              Http_Command,   Web_DebugOn },
+    { "/debug/off",             Http_Command,   Web_DebugOff },
+    { "/switchState",           Http_Command,   Web_SwitchState },
+    { "/activateBridge/raise",  Http_Command,   Web_Raise },
+    { "/activateBridge/lower",  Http_Command,   Web_Lower },
+};
+const uint8_t httpRouteCount = COUNT_OF(httpRoutes);
+
+// The page reads these names
+const JsonField httpStateSchema[] = {
+    JSON_FIELD("bridgeState",       Json_U8,        ControlState, state),
+    JSON_FIELD("nextState",         Json_Str,       ControlState, nextState),
+};
+const uint8_t httpStateFieldCount = JSON_COUNT(httpStateSchema);
+
+void httpSite_reply(JsonWriter& json, const WebReply&) {
+    json.beginObject().endObject();
+}
@@ -0,0 +1,37 @@
+#ifndef HTTPSITE_H
+#define HTTPSITE_H
+
+#include <Arduino.h>
+#include "StateMachine.h"
+
+// What this sketch's web server serves (see HttpTask.h). The routes and the
+// /state schema are in HttpSite.cpp.
+
+#define HttpSite_StateBytes     96      // /state as an event, see httpStateSchema
+#define HttpSite_ReplyBytes     8       // no route here waits on loop()
+
+enum WebCommandType : uint8_t {
+    Web_EStopOn,
+    Web_EStopOff,
+    Web_DebugOn,
+    Web_DebugOff,
+    Web_SwitchState,
+    Web_Raise,
+    Web_Lower
+};
+
+struct WebReply {
+    uint16_t ticket;
+};
+
+struct ControlState {
+    bridgeState state;
+    const char* nextState;  // getStateName(), a string literal, so either side can read it
+};
+
+// What the page lights up for; a change goes out at once
+inline bool sameLights(const ControlState& a, const ControlState& b) {
+    return a.state == b.state;
+}
+
+#endif
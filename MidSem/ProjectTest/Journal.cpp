@@ -0,0 +1,110 @@
+#include "Journal.h"
+#include "main.h"
+
+Journal journal;
+
+// Largest thing one pass can write: config + key at the start of a half,
+// a forced state, a full frame (5-byte varint) and an output record.
+static const size_t worstPass = (1 + sizeof(BridgeConfig)) + 11 + 2 + 10 + 4;
+
+Journal::Journal() {
+    len[0] = len[1] = 0;
+    cur = 0;
+    wrapped = false;
+    haveFrame = false;
+    lastMs = 0;
+    memset(&lastConfig, 0, sizeof(lastConfig));
+    lastOut = JournalOut{ 0, 0xFF, 0 };
+    passes = 0;
+}
+
+void Journal::putConfig(const BridgeConfig& c) {
+    put(J_Config);
+    const uint8_t* p = (const uint8_t*)&c;
+    for (size_t i = 0; i < sizeof(BridgeConfig); i++) put(p[i]);
+    lastConfig = c;
+}
+
+// Each half can be replayed on its own: it opens with the configuration
+// and where the state machine was.
+void Journal::startHalf(uint32_t nowMs, uint8_t state, uint32_t inStateMs) {
+    len[cur] = 0;
+    putConfig(bridgeConfig.getConfig());
+    put(J_Key);
+    put(Journal_Version);
+    put32(nowMs);
+    put(state);
+    put32(inStateMs);
+    lastMs = nowMs;
+    haveFrame = false;
+    lastOut = JournalOut{ 0, 0xFF, 0 };
+}
+
+bool Journal::sameInputs(const SensorFrame& f) const {
+    return f.sonic == lastFrame.sonic && f.sonicConfidence == lastFrame.sonicConfidence
+        && f.eStop == lastFrame.eStop && f.topLimit == lastFrame.topLimit
+        && f.bottomLimit == lastFrame.bottomLimit;
+}
+
+void Journal::pass(const SensorFrame& f, uint8_t state, uint32_t inStateMs, uint8_t forced) {
+    if (passes == 0 || len[cur] + worstPass > Journal_HalfBytes) {
+        if (passes) { cur ^= 1; wrapped = true; }
+        startHalf(f.timeMs, state, inStateMs);
+    } else if (memcmp(&bridgeConfig.getConfig(), &lastConfig, sizeof(BridgeConfig)) != 0) {
+        putConfig(bridgeConfig.getConfig());
+    }
+    passes++;
+
+    if (forced) { put(J_Set); put(forced); }
+    uint32_t dt = f.timeMs - lastMs;
+    lastMs = f.timeMs;
+    if (haveFrame && sameInputs(f)) {
+        put(J_Same);
+        putVar(dt);
+        return;
+    }
+    put(J_Frame);
+    putVar(dt);
+    put16(f.sonic.mm());
+    put(f.sonicConfidence);
+    put((f.eStop ? J_EStop : 0) | (f.topLimit ? J_Top : 0) | (f.bottomLimit ? J_Bottom : 0));
+    lastFrame = f;
+    haveFrame = true;
+}
+
+void Journal::out(const JournalOut& o) {
+    if (o == lastOut) return;
+    put(J_Out);
+    put(o.state);
+    put(o.lights);
+    put(o.drive);
+    lastOut = o;
+}
+
+size_t Journal::copy(uint8_t* out, size_t max) const {
+    size_t n = 0;
+    if (wrapped) {
+        for (size_t i = 0; i < len[cur ^ 1] && n < max; i++) out[n++] = buf[cur ^ 1][i];
+    }
+    for (size_t i = 0; i < len[cur] && n < max; i++) out[n++] = buf[cur][i];
+    return n;
+}
+
+void Journal::dump() {
+    static const char hex[] = "0123456789abcdef";
+    Serial.print(F("JOURNAL "));
+    Serial.println((unsigned long)size());
+    char line[65];
+    uint8_t col = 0;
+    for (uint8_t h = 0; h < 2; h++) {
+        uint8_t half = h == 0 ? cur ^ 1 : cur;
+        if (h == 0 && !wrapped) continue;
+        for (size_t i = 0; i < len[half]; i++) {
+            line[col++] = hex[buf[half][i] >> 4];
+            line[col++] = hex[buf[half][i] & 15];
+            if (col == 64) { line[col] = 0; Serial.println(line); col = 0; }
+        }
+    }
+    if (col) { line[col] = 0; Serial.println(line); }
+    Serial.println(F("END"));
+}
@@ -0,0 +1,103 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <Arduino.h>
+#include "StateMachine.h"
+#include "BridgeConfig.h"
+
+/*
+ * INPUT JOURNAL
+ * =============
+ *
+ * Binary record of everything the state machine is given, so a field
+ * incident can be replayed on the host (host/journal_replay.cpp) and come
+ * out with the same transitions and outputs.
+ *
+ * The state machine is a function of: the SensorFrame of each pass, states
+ * forced from outside (web page / serial), and the configuration. Those are
+ * recorded, plus what came out, so the replay can be checked:
+ *
+ *   J_Config  BridgeConfig bytes            config changed (or start of a half)
+ *   J_Key     u8 version, u32 timeMs,       start of a half: where the FSM was
+ *             u8 state, u32 inStateMs       (state 0 = not started yet)
+ *   J_Frame   varint dtMs, u16 sonicMm,     one pass, new inputs
+ *             u8 confidence, u8 flags
+ *   J_Same    varint dtMs                   one pass, same inputs as the last
+ *   J_Set     u8 state                      currentState forced before a pass
+ *   J_Out     u8 state, u8 lights, u8 drive outputs after a pass, when changed
+ *
+ * An idle pass costs two bytes. The buffer is two halves: when one fills,
+ * recording carries on in the other, which starts with a config and key
+ * record so it can be replayed on its own. The dump always holds the last
+ * full half plus the current one. The photocell is not journalled; the
+ * state machine never reads it.
+ *
+ * Serial command "journal" prints the buffer as hex between "JOURNAL <bytes>"
+ * and "END" lines; save the serial log and feed it to the replayer.
+ */
+
+#define Journal_HalfBytes   4096
+#define Journal_Version     1
+
+enum JournalTag : uint8_t {
+    J_Config = 0xC1,
+    J_Key    = 0xC2,
+    J_Frame  = 0xC3,
+    J_Same   = 0xC4,
+    J_Set    = 0xC5,
+    J_Out    = 0xC6
+};
+
+// Frame flag bits
+#define J_EStop     0x01
+#define J_Top       0x02
+#define J_Bottom    0x04
+
+// Outputs after a pass, as journalled in J_Out
+struct JournalOut {
+    uint8_t state;
+    uint8_t lights;     // bit 0 red, 1 yellow, 2 green
+    uint8_t drive;      // motor drive pin duty
+    bool operator==(const JournalOut& o) const { return state == o.state && lights == o.lights && drive == o.drive; }
+    bool operator!=(const JournalOut& o) const { return !(*this == o); }
+};
+
+class Journal {
+    private:
+        uint8_t buf[2][Journal_HalfBytes];
+        uint16_t len[2];
+        uint8_t cur;
+        bool wrapped;
+        bool haveFrame;         // lastFrame is valid for J_Same
+        SensorFrame lastFrame;
+        uint32_t lastMs;
+        BridgeConfig lastConfig;
+        JournalOut lastOut;
+        uint32_t passes;
+
+        void put(uint8_t b) { buf[cur][len[cur]++] = b; }
+        void put16(uint16_t v) { put(v); put(v >> 8); }
+        void put32(uint32_t v) { put16(v); put16(v >> 16); }
+        void putVar(uint32_t v) { while (v >= 0x80) { put(v | 0x80); v >>= 7; } put(v); }
+        void putConfig(const BridgeConfig& c);
+        void startHalf(uint32_t nowMs, uint8_t state, uint32_t inStateMs);
+        bool sameInputs(const SensorFrame& f) const;
+    public:
+        Journal();
+
+        // Call at the top of each state machine pass, before anything acts on
+        // the frame. state/inStateMs describe the FSM as the pass finds it;
+        // forced is currentState if something outside set it, else 0.
+        void pass(const SensorFrame& f, uint8_t state, uint32_t inStateMs, uint8_t forced);
+        // Call at the end of the pass
+        void out(const JournalOut& o);
+
+        size_t size() const { return (wrapped ? len[cur ^ 1] : 0) + len[cur]; }
+        size_t copy(uint8_t* out, size_t max) const;   // oldest first
+        uint32_t passCount() const { return passes; }
+        void dump();
+};
+
+extern Journal journal;
+
+#endif
@@ -0,0 +1,138 @@
+#include "RunLoop.h"
+
+#ifdef ESP32
+static TaskHandle_t loopTask = NULL;
+#endif
+
+RunLoop runLoop;
+
+RunLoop::RunLoop() {
+    jobCount = 0;
+    pass = NULL;
+    deadline = NULL;
+    pending = false;
+    wokenAt = 0;
+    wakeLock = portMUX_INITIALIZER_UNLOCKED;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void RunLoop::begin() {
+#ifdef ESP32
+    loopTask = xTaskGetCurrentTaskHandle();
+#endif
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < jobCount; i++) jobs[i].nextMs = now;
+}
+
+int RunLoop::every(uint32_t periodMs, RunJob fn, bool feedsPass) {
+    if (jobCount >= RunLoop_MaxJobs) return -1;
+    jobs[jobCount].fn = fn;
+    jobs[jobCount].periodMs = periodMs;
+    jobs[jobCount].nextMs = millis();
+    jobs[jobCount].feedsPass = feedsPass;
+    return jobCount++;
+}
+
+void RunLoop::setPeriod(int job, uint32_t periodMs) {
+    if (job < 0 || job >= jobCount) return;
+    jobs[job].nextMs += periodMs - jobs[job].periodMs;
+    jobs[job].periodMs = periodMs;
+}
+
+void RunLoop::onPass(RunJob fn, RunDeadline nextDeadline) {
+    pass = fn;
+    deadline = nextDeadline;
+}
+
+void RunLoop::watch(uint8_t pin) {
+    attachInterruptArg(digitalPinToInterrupt(pin), edgeISR, this, CHANGE);
+}
+
+void IRAM_ATTR RunLoop::edgeISR(void* arg) {
+    ((RunLoop*)arg)->wakeFromISR();
+}
+
+void IRAM_ATTR RunLoop::wakeFromISR() {
+    portENTER_CRITICAL_ISR(&wakeLock);
+    if (!pending) {
+        wokenAt = micros();
+        pending = true;
+    }
+    portEXIT_CRITICAL_ISR(&wakeLock);
+#ifdef ESP32
+    if (loopTask) {
+        BaseType_t higher = pdFALSE;
+        vTaskNotifyGiveFromISR(loopTask, &higher);
+        if (higher) portYIELD_FROM_ISR();
+    }
+#endif
+}
+
+// Block for up to ms, or until an edge. Whether one came is takeWake()'s to say.
+void RunLoop::sleepMs(uint32_t ms) {
+#ifdef ESP32
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+#else
+    hal_advanceTo(hal_nowUs() + (uint64_t)ms * 1000, &pending);
+#endif
+}
+
+// Reads and clears the wake in one step, so an edge is either seen here or
+// left pending for the next call, never cleared unseen. A notification left
+// over from an edge that was taken before the sleep only makes the next
+// sleep return early.
+bool RunLoop::takeWake(uint32_t& edgeAt) {
+    portENTER_CRITICAL(&wakeLock);
+    bool woken = pending;
+    edgeAt = wokenAt;
+    pending = false;
+    portEXIT_CRITICAL(&wakeLock);
+    return woken;
+}
+
+void RunLoop::runOnce() {
+    uint32_t now = millis();
+    uint32_t wait = RunLoop_MaxSleepMs;
+    uint32_t passDue = UINT32_MAX;
+    for (uint8_t i = 0; i < jobCount; i++) {
+        int32_t left = (int32_t)(jobs[i].nextMs - now);
+        uint32_t due = left > 0 ? (uint32_t)left : 0;
+        if (due < wait) wait = due;
+    }
+    if (deadline) {
+        passDue = deadline(now);
+        if (passDue < wait) wait = passDue;
+    }
+
+    uint32_t edgeAt;
+    bool event = takeWake(edgeAt);
+    if (!event && wait > 0) {
+        sleepMs(wait);
+        event = takeWake(edgeAt);
+    }
+
+    now = millis();
+    bool runPass = event || passDue <= wait;
+    for (uint8_t i = 0; i < jobCount; i++) {
+        Job& j = jobs[i];
+        if ((int32_t)(now - j.nextMs) < 0) continue;
+        j.fn(now);
+        runPass |= j.feedsPass;
+        j.nextMs += j.periodMs;
+        // Fell behind (long web request, emergency delay): skip, don't burst
+        if ((int32_t)(now - j.nextMs) >= 0) j.nextMs = now + j.periodMs;
+    }
+    stats.wakes++;
+    if (runPass && pass) {
+        pass(now);
+        stats.passes++;
+    }
+
+    if (event) {
+        stats.eventWakes++;
+        stats.lastWakeUs = micros() - edgeAt;
+        if (stats.lastWakeUs > stats.maxWakeUs) stats.maxWakeUs = stats.lastWakeUs;
+    } else {
+        stats.timerWakes++;
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef RUNLOOP_H
+#define RUNLOOP_H
+
+#include <Arduino.h>
+
+/*
+ * TICKLESS RUN LOOP
+ * =================
+ *
+ * Replaces the fixed delay(50) at the end of loop(). Each call to runOnce()
+ * sleeps until the earliest of:
+ *   - an input edge (any pin passed to watch() - E-stop, limit switches),
+ *   - the next periodic job (web/serial polling, sonic ping, sensor log),
+ *   - the state machine's own next deadline (prep timers, motion timeout),
+ * then runs the jobs that are due. The state machine pass only runs when
+ * there is something new for it: an edge, its own deadline, or a job that
+ * feeds it (the sonic ping) - polling the web server alone doesn't.
+ *
+ * On the ESP32 the sleep is a FreeRTOS task notification wait, so the loop
+ * task really blocks and an edge ISR wakes it within microseconds. On the
+ * host (see host/hal) time is virtual and sleeping just moves the clock, so
+ * the same loop can be benchmarked without waiting for it.
+ */
+
+#define RunLoop_MaxJobs     8
+#define RunLoop_MaxSleepMs  1000    // upper bound on one sleep, in case a wake is lost
+
+typedef void (*RunJob)(uint32_t nowMs);
+typedef uint32_t (*RunDeadline)(uint32_t nowMs);  // ms until due, UINT32_MAX = nothing pending
+
+struct RunLoopStats {
+    uint32_t wakes;         // times the loop woke up
+    uint32_t passes;        // state machine passes run
+    uint32_t eventWakes;    // woken by an input edge
+    uint32_t timerWakes;    // woken by a deadline
+    uint32_t lastWakeUs;    // edge -> state machine pass done, last event wake
+    uint32_t maxWakeUs;     // ...and the worst seen
+};
+
+class RunLoop {
+    private:
+        struct Job {
+            RunJob fn;
+            uint32_t periodMs;
+            uint32_t nextMs;
+            bool feedsPass;
+        };
+        Job jobs[RunLoop_MaxJobs];
+        uint8_t jobCount;
+        RunJob pass;
+        RunDeadline deadline;
+        volatile bool pending;          // set by wake(), cleared when the loop runs
+        volatile uint32_t wokenAt;      // micros() of the first wake since the last pass
+        portMUX_TYPE wakeLock;          // pending and wokenAt, between the ISR and takeWake()
+        RunLoopStats stats;
+
+        void sleepMs(uint32_t ms);
+        bool takeWake(uint32_t& edgeAt);
+        static void edgeISR(void* arg);
+    public:
+        RunLoop();
+        void begin();                                   // from the loop task, before anything can wake it
+        // Returns the job id, -1 if the table is full. feedsPass: run the
+        // state machine after this job (it produced new input).
+        int every(uint32_t periodMs, RunJob fn, bool feedsPass = false);
+        void setPeriod(int job, uint32_t periodMs);
+        void onPass(RunJob fn, RunDeadline nextDeadline);
+        void watch(uint8_t pin);                        // wake on any edge of this input
+        void wakeFromISR();
+        void runOnce();
+        const RunLoopStats& getStats() const { return stats; }
+};
+
+extern RunLoop runLoop;
+
+#endif
@@ -1,24 +1,48 @@
 #include "SonicSensor.h"
 
-Sonic::Sonic(int trig, int echo) {
+Sonic::Sonic(int trig, int echo) : capture(trig, echo) {
     trigPin = trig;
     echoPin = echo;
+    lastCount = 0;
 }
 
 void Sonic::init() {
-    pinMode(trigPin, OUTPUT);
-    pinMode(echoPin, OUTPUT);
+    capture.init();
 }
 
-double Sonic::pollRaw() {
-    digitalWrite(trigPin, LOW);
-    delayMicroseconds(2);
-    digitalWrite(trigPin, HIGH);
-    delayMicroseconds(10);
-    digitalWrite(trigPin, LOW);
-    return pulseIn(echoPin, HIGH);
+// Start a new ping if the last one has finished. Never waits for the echo.
+void Sonic::trigger() {
+    capture.trigger();
 }
 
-double Sonic::poll_cm() {
-    return pollRaw() * 0.0343 / 2.0;
-}
\ No newline at end of file
+// Latest completed echo width (us), 0 if there was no echo.
+// Kicks off the next ping so repeated polling keeps the reading fresh.
+EchoTimeUS Sonic::pollRaw() {
+    capture.trigger();
+    return EchoTimeUS(capture.widthUs());
+}
+
+DistanceMM Sonic::poll() {
+    return DistanceMM::fromEcho(pollRaw());
+}
+
+// Latest distance without starting another ping.
+DistanceMM Sonic::read() {
+    return DistanceMM::fromEcho(EchoTimeUS(capture.widthUs()));
+}
+
+// Distance of the newest echo, only if it arrived since the last call.
+// This is what feeds the DistanceFilter: each echo is seen exactly once.
+bool Sonic::readEcho(DistanceMM& distance) {
+    EchoSample s;
+    if (!capture.latest(s) || s.count == lastCount) return false;
+    lastCount = s.count;
+    distance = DistanceMM::fromEcho(EchoTimeUS(s.widthUs));
+    return true;
+}
+
+uint32_t Sonic::lastEchoMicros() {
+    EchoSample s;
+    capture.latest(s);
+    return s.stampUs;
+}
@@ -2,16 +2,24 @@
 #define SONICSENSOR_H
 
 #include <Arduino.h>
+#include "EchoCapture.h"
+#include "Units.h"
 
 class Sonic {
     private:
         int trigPin;
         int echoPin;
+        EchoCapture capture;
+        uint32_t lastCount;
     public:
         Sonic(int trig, int echo);
         void init();
-        double pollRaw();
-        double poll_cm();
+        void trigger();
+        EchoTimeUS pollRaw();
+        DistanceMM poll();
+        DistanceMM read();
+        bool readEcho(DistanceMM& distance);
+        uint32_t lastEchoMicros();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -16,8 +16,8 @@
  *    - Automatic timestamp generation for all log entries
  * 
  * 3. ENHANCED STATE MANAGEMENT:
- *    - Previous state tracking with previousState variable
- *    - One-time initialization pattern for state entry operations
+ *    - Table-driven engine (Fsm.h) with per-state enter/tick/exit handlers
+ *    - Entry actions run exactly once per entry, owned by the engine
  *    - Automatic state transition logging when enabled
  *    - Helper functions integrated with configuration system
  * 
@@ -31,17 +31,19 @@
  * 
  * CONFIGURATION ACCESS PATTERN:
  * - Instead of: if (millis() - startTime > 3000)
- * - Now use:    if (millis() - startTime > bridgeConfig.getActionDelay())
+ * - Now use:    timers.start(Timer_PrepRaise, now, bridgeConfig.getActionDelay())
+ *               on entry, then timers.take(Timer_PrepRaise) in the state
  * 
  * CONDITIONAL LOGGING PATTERN:
  * - Check configuration flag before any output operation
  * - Example: if (bridgeConfig.isDebugLoggingEnabled()) debugLog("message");
  * - Logging functions automatically check their respective flags
  * 
- * STATE INITIALIZATION PATTERN:
- * - Static boolean flags prevent repeated initialization in states
- * - Pattern: static bool initialized = false; if (!initialized) { setup; initialized = true; }
- * - Flags reset when exiting states to allow re-initialization
+ * STATE HANDLER PATTERN:
+ * - Each state is one row in bridgeStates[]: enter, tick and (optional) exit
+ * - enter() does the one-time setup (timers, motor start, sensor log)
+ * - tick() gets the time spent in the state and returns the next state
+ * - The engine runs exit/enter on every change, so no state keeps its own flags
  * 
  * HELPER FUNCTION ENHANCEMENTS:
  * - All sensor thresholds now use configurable values
@@ -65,41 +67,74 @@
 #include "TrafficLight.h"
 #include "SonicSensor.h"
 #include "DCMotor.h"
+#include "DistanceFilter.h"
+#include "Fsm.h"
+#include "TimerService.h"
 
 // External modules (from other files)
 extern TrafficModule trafficLight;
-extern Sonic sonicSensor;
+extern Sonic& sonicSensor;
 extern Motor motor;
 
 //  starting position
 bridgeState currentState = lowered;
-bridgeState previousState = lowered;
 
-// Timers
-unsigned long startTime = 0;
+// Sonic filter stage: range gate (sonic_min/sonic_max from config), median of
+// the last 5 good echoes, and a confidence score the detections must meet.
+const uint8_t sonicMinConfidence = 60;
+DistanceFilter<5> sonicFilter(20_mm, 4000_mm, 50_mm);
+
+// Named timers. Each is armed by the state that owns it on entry and
+// cancelled on its exit; the state only asks whether it has fired.
+enum BridgeTimer : uint8_t {
+  Timer_PrepRaise,
+  Timer_RaiseTimeout,
+  Timer_PrepLower,
+  Timer_LowerTimeout,
+  Timer_EmergencyDwell,
+  Timer_EmergencyTimeout,
+  Timer_Count
+};
+static TimerService<Timer_Count> timers;
 
 
 // Helper functions
 
-bool eStopPressed()   { 
-  return bridgeConfig.isEmergencyStopEnabled() ? digitalRead(Pin_EStop) == HIGH : false; 
+// Run at the ping rate: feed the last echo to the filter and fire the next one.
+void sonicService(uint32_t nowMs) {
+  DistanceMM echo;
+  if (sonicSensor.readEcho(echo)) {
+    sonicFilter.setRange(bridgeConfig.getSonicMinRange(), bridgeConfig.getSonicMaxRange());
+    sonicFilter.push(echo);
+  }
+  sonicSensor.trigger();
 }
-bool topLimitHit()    { return digitalRead(Pin_LS_1) == HIGH; }
-bool bottomLimitHit() { return digitalRead(Pin_LS_2) == HIGH; }
-bool boatDetected()   { 
-  int distance = sonicSensor.poll_cm();
-  return (distance > 0 && distance < bridgeConfig.getBoatDetectionDistance()); 
+
+SensorFrame captureSensors() {
+  SensorFrame frame;
+  frame.timeMs      = millis();
+  frame.sonic       = sonicFilter.median();
+  frame.sonicConfidence = sonicFilter.confidence();
+  frame.eStop       = bridgeConfig.isEmergencyStopEnabled() ? digitalRead(Pin_EStop) == HIGH : false;
+  frame.topLimit    = digitalRead(Pin_LS_1) == HIGH;
+  frame.bottomLimit = digitalRead(Pin_LS_2) == HIGH;
+  frame.photoCell   = analogRead(Pin_PhotoCell);
+  return frame;
 }
-bool areaClear()      { 
-  int distance = sonicSensor.poll_cm();
-  return (distance > bridgeConfig.getAreaClearDistance()); 
+
+bool boatDetected(const SensorFrame& frame) { 
+  if (frame.sonicConfidence < sonicMinConfidence) return false;
+  return (frame.sonic > 0_mm && frame.sonic < bridgeConfig.getBoatDetectionDistance()); 
 }
-bool timerFinished()  { 
-  return millis() - startTime > bridgeConfig.getActionDelay(); 
+bool areaClear(const SensorFrame& frame) { 
+  if (frame.sonicConfidence < sonicMinConfidence) return false;
+  return (frame.sonic > bridgeConfig.getAreaClearDistance()); 
 }
-bool motionTimeout()  { 
-  return bridgeConfig.isMotionTimeoutEnabled() ? 
-    (millis() - startTime > bridgeConfig.getMoveTimeout()) : false; 
+// Motion timeouts are only armed when enabled in the configuration
+void startMotionTimeout(BridgeTimer timer, unsigned long nowMs) {
+  if (bridgeConfig.isMotionTimeoutEnabled()) {
+    timers.start(timer, nowMs, bridgeConfig.getMoveTimeout());
+  }
 }
 
 void startMotorUp()   { 
@@ -124,189 +159,269 @@ void stopMotor()      {
 }
 
 
-// Main state machine logic
+// State handlers (one row each in bridgeStates[] below)
 
-void stateMachine(bridgeState state) {
-  // Log state change if different from previous state
-  if (state != previousState && bridgeConfig.isStateLoggingEnabled()) {
-    debugLogStateChange(state);
-    previousState = state;
+//  DOWN (lowered) 
+static void loweredEnter(const SensorFrame& frame) {
+  trafficLight.cycle(2);
+}
+static bridgeState loweredTick(const SensorFrame& frame, uint32_t inStateMs) {
+  if (boatDetected(frame)) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("Boat detected, preparing to raise bridge");
+    }
+    return prepareRaise;
   }
+  return lowered;
+}
 
-  switch (state) {
-
-    //  DOWN (lowered) 
-    case lowered:
-      trafficLight.cycle(2);
-      
-      if (boatDetected()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("Boat detected, preparing to raise bridge");
-        }
-        currentState = prepareRaise;
-      }
-      break;
+// === PREP TO RAISE ===
+static void prepareRaiseEnter(const SensorFrame& frame) {
+  timers.start(Timer_PrepRaise, frame.timeMs, bridgeConfig.getActionDelay());
+  trafficLight.cycle(0);
+  if (bridgeConfig.isSensorLoggingEnabled()) {
+    debugLogSensors(frame);
+  }
+}
+static bridgeState prepareRaiseTick(const SensorFrame& frame, uint32_t inStateMs) {
+  if (frame.eStop) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("Emergency stop pressed during prep to raise");
+    }
+    return emergencyLower;
+  }
+  if (timers.take(Timer_PrepRaise)) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("Preparation timer completed, starting to raise bridge");
+    }
+    return raising;
+  }
+  return prepareRaise;
+}
+static void prepareRaiseExit(const SensorFrame& frame) {
+  timers.cancel(Timer_PrepRaise);
+}
 
-    // === PREP TO RAISE ===
-    case prepareRaise:
-      trafficLight.cycle(0);
-      
-      // Initialize timer on first entry to this state
-      static bool prepRaiseInitialized = false;
-      if (!prepRaiseInitialized) {
-        startTime = millis();
-        if (bridgeConfig.isSensorLoggingEnabled()) {
-          debugLogSensors();
-        }
-        prepRaiseInitialized = true;
-      }
+// === RAISING ===
+static void raisingEnter(const SensorFrame& frame) {
+  startMotorUp();
+  startMotionTimeout(Timer_RaiseTimeout, frame.timeMs);
+}
+static bridgeState raisingTick(const SensorFrame& frame, uint32_t inStateMs) {
+  if (frame.eStop) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("EMERGENCY: E-stop pressed while raising bridge");
+    }
+    return emergencyLower;
+  }
+  if (frame.topLimit || timers.take(Timer_RaiseTimeout)) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog(frame.topLimit ? "Top limit switch reached" : "Motion timeout reached");
+    }
+    return raised;
+  }
+  return raising;
+}
+// However the state is left (limit, timeout, E-stop, the web page), the
+// motor stops here
+static void raisingExit(const SensorFrame& frame) {
+  stopMotor();
+  timers.cancel(Timer_RaiseTimeout);
+}
 
-      if (eStopPressed()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("Emergency stop pressed during prep to raise");
-        }
-        prepRaiseInitialized = false;
-        currentState = emergencyLower;
-      } 
-      else if (timerFinished()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("Preparation timer completed, starting to raise bridge");
-        }
-        prepRaiseInitialized = false;
-        currentState = raising;
-      }
-      break;
+// === UP (raised) ===
+static void raisedEnter(const SensorFrame& frame) {
+  trafficLight.cycle(0);
+}
+static bridgeState raisedTick(const SensorFrame& frame, uint32_t inStateMs) {
+  if (areaClear(frame)) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("Area clear detected, preparing to lower bridge");
+    }
+    return prepareLower;
+  }
+  return raised;
+}
 
-    // === RAISING ===
-    case raising:
-      // Initialize motor on first entry to this state
-      static bool raisingInitialized = false;
-      if (!raisingInitialized) {
-        startMotorUp();
-        startTime = millis();
-        raisingInitialized = true;
-      }
+// === PREP TO LOWER ===
+static void prepareLowerEnter(const SensorFrame& frame) {
+  timers.start(Timer_PrepLower, frame.timeMs, bridgeConfig.getActionDelay());
+  trafficLight.cycle(0);
+  if (bridgeConfig.isSensorLoggingEnabled()) {
+    debugLogSensors(frame);
+  }
+}
+static bridgeState prepareLowerTick(const SensorFrame& frame, uint32_t inStateMs) {
+  if (frame.eStop) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("Emergency stop pressed during prep to lower");
+    }
+    return emergencyRaise;
+  }
+  if (timers.take(Timer_PrepLower)) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("Preparation timer completed, starting to lower bridge");
+    }
+    return lowering;
+  }
+  return prepareLower;
+}
+static void prepareLowerExit(const SensorFrame& frame) {
+  timers.cancel(Timer_PrepLower);
+}
+
+// === LOWERING ===
+static void loweringEnter(const SensorFrame& frame) {
+  startMotorDown();
+  startMotionTimeout(Timer_LowerTimeout, frame.timeMs);
+}
+static bridgeState loweringTick(const SensorFrame& frame, uint32_t inStateMs) {
+  if (frame.eStop) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog("EMERGENCY: E-stop pressed while lowering bridge");
+    }
+    return emergencyRaise;
+  }
+  if (frame.bottomLimit || timers.take(Timer_LowerTimeout)) {
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog(frame.bottomLimit ? "Bottom limit switch reached" : "Motion timeout reached");
+    }
+    return lowered;
+  }
+  return lowering;
+}
+static void loweringExit(const SensorFrame& frame) {
+  stopMotor();
+  timers.cancel(Timer_LowerTimeout);
+}
 
-      if (eStopPressed()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("EMERGENCY: E-stop pressed while raising bridge");
-        }
-        raisingInitialized = false;
-        currentState = emergencyLower;
-      } 
-      else if (topLimitHit() || motionTimeout()) {
+// === EMERGENCY LOWER / RAISE ===
+// Both procedures are a short step machine inside their state, so every pass
+// returns straight away and the web page, sensors and E-stop stay live:
+//   Stop   motor off, wait out emergencyDelay before reversing it
+//   Drive  run toward the limit switch; done when it closes
+//   Fault  the motion timeout ran out first; motor off until the switch
+//          closes or the operator picks another state
+enum EmergencyStep : uint8_t { Emergency_Stop, Emergency_Drive, Emergency_Fault };
+static EmergencyStep emergencyStep = Emergency_Stop;
+
+static void emergencyEnter(const SensorFrame& frame) {
+  stopMotor();
+  emergencyStep = Emergency_Stop;
+  timers.start(Timer_EmergencyDwell, frame.timeMs, bridgeConfig.getEmergencyDelay());
+  if (bridgeConfig.isSensorLoggingEnabled()) {
+    debugLogSensors(frame);
+  }
+}
+
+static bridgeState emergencyTick(const SensorFrame& frame, bool up, bridgeState self, bridgeState done) {
+  bool atLimit = up ? frame.topLimit : frame.bottomLimit;
+  if (atLimit) {
+    if (emergencyStep == Emergency_Drive) stopMotor();
+    if (bridgeConfig.isDebugLoggingEnabled()) {
+      debugLog(up ? "Emergency raise completed" : "Emergency lower completed");
+    }
+    return done;
+  }
+
+  switch (emergencyStep) {
+    case Emergency_Stop:
+      if (timers.take(Timer_EmergencyDwell)) {
+        if (up) startMotorUp(); else startMotorDown();
+        startMotionTimeout(Timer_EmergencyTimeout, frame.timeMs);
+        emergencyStep = Emergency_Drive;
+      }
+      break;
+    case Emergency_Drive:
+      if (timers.take(Timer_EmergencyTimeout)) {
         stopMotor();
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog(topLimitHit() ? "Top limit switch reached" : "Motion timeout reached");
-        }
-        raisingInitialized = false;
-        currentState = raised;
+        debugLog("EMERGENCY: limit switch not reached, motor stopped");
+        emergencyStep = Emergency_Fault;
       }
       break;
+    case Emergency_Fault:
+      break;
+  }
+  return self;
+}
 
-    // === UP (raised) ===
-    case raised:
-      trafficLight.cycle(0);
+static void emergencyExit(const SensorFrame& frame) {
+  timers.cancel(Timer_EmergencyDwell);
+  timers.cancel(Timer_EmergencyTimeout);
+  if (emergencyStep == Emergency_Drive) stopMotor();
+}
 
-      if (areaClear()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("Area clear detected, preparing to lower bridge");
-        }
-        currentState = prepareLower;
-      }
-      break;
+static void emergencyLowerEnter(const SensorFrame& frame) {
+  debugLog("EMERGENCY PROCEDURE: Lowering bridge");
+  emergencyEnter(frame);
+}
+static bridgeState emergencyLowerTick(const SensorFrame& frame, uint32_t inStateMs) {
+  return emergencyTick(frame, false, emergencyLower, lowered);
+}
 
-    // === PREP TO LOWER ===
-    case prepareLower:
-      trafficLight.cycle(0);
-      
-      // Initialize timer on first entry to this state
-      static bool prepLowerInitialized = false;
-      if (!prepLowerInitialized) {
-        startTime = millis();
-        if (bridgeConfig.isSensorLoggingEnabled()) {
-          debugLogSensors();
-        }
-        prepLowerInitialized = true;
-      }
+static void emergencyRaiseEnter(const SensorFrame& frame) {
+  debugLog("EMERGENCY PROCEDURE: Raising bridge");
+  emergencyEnter(frame);
+}
+static bridgeState emergencyRaiseTick(const SensorFrame& frame, uint32_t inStateMs) {
+  return emergencyTick(frame, true, emergencyRaise, raised);
+}
 
-      if (eStopPressed()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("Emergency stop pressed during prep to lower");
-        }
-        prepLowerInitialized = false;
-        currentState = emergencyRaise;
-      } 
-      else if (timerFinished()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("Preparation timer completed, starting to lower bridge");
-        }
-        prepLowerInitialized = false;
-        currentState = lowering;
-      }
-      break;
+static constexpr FsmRow<bridgeState, const SensorFrame> bridgeStates[] = {
+  { lowered,        loweredEnter,      loweredTick,        nullptr },
+  { prepareRaise,   prepareRaiseEnter, prepareRaiseTick,   prepareRaiseExit },
+  { raising,        raisingEnter,      raisingTick,        raisingExit },
+  { raised,         raisedEnter,       raisedTick,         nullptr },
+  { prepareLower,   prepareLowerEnter, prepareLowerTick,   prepareLowerExit },
+  { lowering,       loweringEnter,     loweringTick,       loweringExit },
+  { emergencyLower, emergencyLowerEnter, emergencyLowerTick, emergencyExit },
+  { emergencyRaise, emergencyRaiseEnter, emergencyRaiseTick, emergencyExit },
+};
+static Fsm<bridgeState, const SensorFrame, 8, bridgeStates> bridge(lowered);
 
-    // === LOWERING ===
-    case lowering:
-      // Initialize motor on first entry to this state
-      static bool loweringInitialized = false;
-      if (!loweringInitialized) {
-        startMotorDown();
-        startTime = millis();
-        loweringInitialized = true;
-      }
 
-      if (eStopPressed()) {
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog("EMERGENCY: E-stop pressed while lowering bridge");
-        }
-        loweringInitialized = false;
-        currentState = emergencyRaise;
-      } 
-      else if (bottomLimitHit() || motionTimeout()) {
-        stopMotor();
-        if (bridgeConfig.isDebugLoggingEnabled()) {
-          debugLog(bottomLimitHit() ? "Bottom limit switch reached" : "Motion timeout reached");
-        }
-        trafficLight.cycle(2);
-        loweringInitialized = false;
-        currentState = lowered;
-      }
-      break;
+// Main state machine logic
 
-    // === EMERGENCY LOWER ===
-    case emergencyLower:
-      if (bridgeConfig.isDebugLoggingEnabled()) {
-        debugLog("EMERGENCY PROCEDURE: Lowering bridge immediately");
-        debugLogSensors();
-      }
-      startMotorDown();
-      delay(bridgeConfig.getEmergencyDelay());
-      stopMotor();
-      if (bridgeConfig.isDebugLoggingEnabled()) {
-        debugLog("Emergency lower completed");
-      }
-      currentState = lowered;
-      break;
+// Time until a state's own timer could move it on, so the run loop knows how
+// long it may sleep. Everything else that changes state is an input edge or
+// a sensor job, which wake the loop themselves.
+uint32_t stateMachineDeadline(uint32_t nowMs) {
+  return timers.msUntilNext(nowMs);
+}
 
-    // === EMERGENCY RAISE ===
-    case emergencyRaise:
-      if (bridgeConfig.isDebugLoggingEnabled()) {
-        debugLog("EMERGENCY PROCEDURE: Raising bridge immediately");
-        debugLogSensors();
-      }
-      startMotorUp();
-      delay(bridgeConfig.getEmergencyDelay());
-      stopMotor();
-      if (bridgeConfig.isDebugLoggingEnabled()) {
-        debugLog("Emergency raise completed");
-      }
-      currentState = raised;
-      break;
+void stateMachine(const SensorFrame& frame) {
+  bool forced = currentState != bridge.state();
+  journal.pass(frame, bridge.running() ? bridge.state() : 0, bridge.inStateMs(frame.timeMs),
+               forced ? currentState : 0);
 
-    default:
-      break;
+  // Anything that set currentState directly is honoured as a transition
+  if (forced) {
+    bridge.go(frame, currentState, frame.timeMs);
+  }
+
+  timers.poll(frame.timeMs);
+  bridgeState before = bridge.state();
+  currentState = bridge.tick(frame, frame.timeMs);
+
+  // Log state change
+  if (currentState != before && bridgeConfig.isStateLoggingEnabled()) {
+    debugLogStateChange(currentState);
   }
+
+  uint8_t lights = (outputs.get(Pin_TrafficRed) ? 1 : 0) | (outputs.get(Pin_TrafficYellow) ? 2 : 0)
+                 | (outputs.get(Pin_TrafficGreen) ? 4 : 0);
+  journal.out(JournalOut{ currentState, lights, motor.drive() });
+}
+
+// Replay only: put the machine in a state as if it had been entered at
+// enteredMs, so its timers run out when they did on the bridge. The state's
+// enter handler runs again, so step machines inside it start from the top.
+void stateMachineRestore(bridgeState state, uint32_t enteredMs) {
+  SensorFrame frame = SensorFrame();
+  frame.timeMs = enteredMs;
+  timers.poll(enteredMs);
+  bridge.go(frame, state, enteredMs);
+  currentState = state;
 }
 
 // Helper function to get state name as string
@@ -332,19 +447,23 @@ void debugLog(const char* message) {
   }
 }
 
-void debugLogSensors() {
+void debugLogSensors(const SensorFrame& frame) {
   if (bridgeConfig.isSensorLoggingEnabled()) {
     Serial.print(F("[SENSORS] "));
-    Serial.print(millis());
+    Serial.print(frame.timeMs);
     Serial.print(F("ms - EStop:"));
-    Serial.print(eStopPressed() ? F("PRESSED") : F("CLEAR"));
+    Serial.print(frame.eStop ? F("PRESSED") : F("CLEAR"));
     Serial.print(F(" | TopLimit:"));
-    Serial.print(topLimitHit() ? F("HIT") : F("CLEAR"));
+    Serial.print(frame.topLimit ? F("HIT") : F("CLEAR"));
     Serial.print(F(" | BottomLimit:"));
-    Serial.print(bottomLimitHit() ? F("HIT") : F("CLEAR"));
+    Serial.print(frame.bottomLimit ? F("HIT") : F("CLEAR"));
     Serial.print(F(" | Sonic:"));
-    Serial.print(sonicSensor.poll_cm());
-    Serial.println(F("cm"));
+    char cm[8];
+    frame.sonic.formatCm(cm);
+    Serial.print(cm);
+    Serial.print(F("cm ("));
+    Serial.print(frame.sonicConfidence);
+    Serial.println(F("%)"));
   }
 }
 
@@ -15,12 +15,28 @@ enum bridgeState : uint8_t {
     emergencyRaise = 8
 };
 
+// Snapshot of every input, captured once per loop() and shared by the
+// state machine and the sensor log so they all see the same readings.
+struct SensorFrame {
+  unsigned long timeMs;
+  DistanceMM sonic;    // primary sonic sensor distance (median filtered)
+  uint8_t sonicConfidence; // 0..100 from the filter; low = no trustworthy echo
+  bool eStop;          // already gated by enableEmergencyStop
+  bool topLimit;
+  bool bottomLimit;
+  int photoCell;       // raw ADC reading
+};
+
 extern bridgeState currentState;
-void stateMachine(bridgeState state);
+SensorFrame captureSensors();
+void sonicService(uint32_t nowMs);
+void stateMachine(const SensorFrame& frame);
+uint32_t stateMachineDeadline(uint32_t nowMs);
+void stateMachineRestore(bridgeState state, uint32_t enteredMs);
 
 // Debug logging functions
 void debugLog(const char* message);
-void debugLogSensors();
+void debugLogSensors(const SensorFrame& frame);
 void debugLogStateChange(bridgeState newState);
 
 // Helper function to get state name as string
@@ -0,0 +1,67 @@
+#ifndef UNITS_H
+#define UNITS_H
+
+#include <stdint.h>
+
+// Fixed-point measurement types for the sensing path: distances are integer
+// millimetres, echo times integer microseconds. There is no floating point
+// anywhere between the echo ISR and the thresholds, and every conversion
+// constant below folds at compile time.
+
+// Speed of sound at ~20C: 343 m/s == 343 mm/ms. An echo covers the distance
+// twice, so mm = us * 343 / 2000.
+#define SOUND_MM_PER_MS 343UL
+
+class EchoTimeUS {
+    private:
+        uint32_t v;
+    public:
+        constexpr EchoTimeUS() : v(0) {}
+        constexpr explicit EchoTimeUS(uint32_t us) : v(us) {}
+        constexpr uint32_t us() const { return v; }
+};
+
+class DistanceMM {
+    private:
+        uint16_t v;
+    public:
+        constexpr DistanceMM() : v(0) {}
+        constexpr explicit DistanceMM(uint16_t mm) : v(mm) {}
+
+        static constexpr DistanceMM fromCm(uint16_t cm) { return DistanceMM((uint16_t)(cm * 10)); }
+        static constexpr DistanceMM fromEcho(EchoTimeUS t) {
+            return DistanceMM((uint16_t)(t.us() * SOUND_MM_PER_MS / 2000UL));
+        }
+        // Round-trip time for an echo off something this far away.
+        constexpr EchoTimeUS echoTime() const { return EchoTimeUS((uint32_t)v * 2000UL / SOUND_MM_PER_MS); }
+
+        constexpr uint16_t mm() const { return v; }
+        constexpr uint16_t cm() const { return v / 10; }
+
+        constexpr bool operator==(DistanceMM o) const { return v == o.v; }
+        constexpr bool operator!=(DistanceMM o) const { return v != o.v; }
+        constexpr bool operator< (DistanceMM o) const { return v <  o.v; }
+        constexpr bool operator<=(DistanceMM o) const { return v <= o.v; }
+        constexpr bool operator> (DistanceMM o) const { return v >  o.v; }
+        constexpr bool operator>=(DistanceMM o) const { return v >= o.v; }
+
+        // Writes centimetres with one decimal ("123.4") to out (>= 8 bytes),
+        // returns the length. Integer only, no printf.
+        uint8_t formatCm(char* out) const {
+            char tmp[6];
+            uint8_t n = 0, len = 0;
+            uint16_t whole = v / 10;
+            do { tmp[n++] = '0' + whole % 10; whole /= 10; } while (whole);
+            while (n) out[len++] = tmp[--n];
+            out[len++] = '.';
+            out[len++] = '0' + v % 10;
+            out[len] = '\0';
+            return len;
+        }
+};
+
+constexpr DistanceMM operator"" _mm(unsigned long long mm) { return DistanceMM((uint16_t)mm); }
+constexpr DistanceMM operator"" _cm(unsigned long long cm) { return DistanceMM((uint16_t)(cm * 10)); }
+constexpr EchoTimeUS operator"" _us(unsigned long long us) { return EchoTimeUS((uint32_t)us); }
+
+#endif
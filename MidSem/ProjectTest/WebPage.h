@@ -3,7 +3,7 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include "HttpTask.h"
 
 #define SSID "ESP32WA8"
 #define PASSWORD "12345678"
@@ -11,14 +11,12 @@
 extern IPAddress local_ip;
 extern IPAddress gateway;
 extern IPAddress subnet;
-extern WebServer server;
 
 void webPage_init();
-void webPage_setupRoutes();
+void webPage_commands();                // loop(): act on what the page asked for
+void webPage_publish(uint32_t nowMs);   // loop(): after commit, hand the state to the http task
 
-//Routes
-void handle_root();
-void handle_stateUpdate();
+//Commands from the page (see webPage_commands)
 void handle_eStop_on();
 void handle_eStop_off();
 void handle_debug_on();
@@ -27,6 +25,4 @@ void handle_switchState();
 void handle_activateBridge_raise();
 void handle_activateBridge_lower();
 
-String createHTML();
-
-#endif
\ No newline at end of file
+#endif
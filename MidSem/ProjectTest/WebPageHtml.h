@@ -0,0 +1,298 @@
+// Auto-generated by Convert on 2026-10-16 23:14:19 from webPageTest.html
+// 23662 bytes of HTML, gzip-compressed to 4475. Send it as is
+// with Content-Encoding: gzip. The hash is FNV-1a of the compressed bytes,
+// and the ETag is the hash quoted, so it changes exactly when the page does.
+
+#ifndef WEBPAGEHTML_H
+#define WEBPAGEHTML_H
+
+#include <Arduino.h>
+
+#define webPage_gzHash     0xfa2dcdb5UL
+#define webPage_gzETag     "\"fa2dcdb5\""
+#define webPage_gzLength   4475
+
+const uint8_t webPage_gz[webPage_gzLength] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x1c, 0x6b, 0x73, 0xdb, 0x36,
+    0xf2, 0x7b, 0x7f, 0x05, 0x4e, 0x6e, 0x47, 0x52, 0x2b, 0x59, 0x24, 0xf5, 0xb4, 0x6c, 0xa9, 0x13,
+    0xe7, 0xd5, 0xcc, 0xe5, 0x35, 0x71, 0xee, 0x32, 0xf7, 0xe9, 0x02, 0x89, 0xa0, 0x84, 0x9a, 0x22,
+    0x35, 0x20, 0x65, 0xc7, 0xc9, 0xf9, 0xbf, 0xdf, 0x02, 0xe0, 0x9b, 0x00, 0x45, 0xc9, 0x4e, 0xef,
+    0xa6, 0x53, 0x2b, 0xb1, 0x25, 0x60, 0xb1, 0xd8, 0x37, 0x16, 0x0b, 0x50, 0x17, 0x7f, 0x7b, 0xf6,
+    0xee, 0xe9, 0xc7, 0x7f, 0xbd, 0x7f, 0x8e, 0xd6, 0xe1, 0xc6, 0x9d, 0xff, 0x70, 0xc1, 0xff, 0x20,
+    0x17, 0x7b, 0xab, 0x59, 0x83, 0x78, 0x0d, 0xde, 0x40, 0xb0, 0x3d, 0xff, 0x01, 0xc1, 0xcf, 0xc5,
+    0x86, 0x84, 0x18, 0x2d, 0xd7, 0x98, 0x05, 0x24, 0x9c, 0x35, 0x76, 0xa1, 0xd3, 0x9d, 0x34, 0x7a,
+    0xd9, 0x3e, 0x0f, 0x6f, 0xc8, 0xac, 0x71, 0x43, 0xc9, 0xed, 0xd6, 0x67, 0x61, 0x03, 0x2d, 0x7d,
+    0x2f, 0x24, 0x1e, 0xc0, 0xde, 0x52, 0x3b, 0x5c, 0xcf, 0x6c, 0x72, 0x43, 0x97, 0xa4, 0x2b, 0x3e,
+    0x74, 0x10, 0xf5, 0x68, 0x48, 0xb1, 0xdb, 0x0d, 0x96, 0xd8, 0x25, 0x33, 0xf3, 0xd4, 0x48, 0x70,
+    0x85, 0x34, 0x74, 0xc9, 0x1c, 0xbd, 0xa1, 0xf6, 0x15, 0xd9, 0xa0, 0x4f, 0x4f, 0x26, 0xe8, 0x29,
+    0x20, 0x62, 0xbe, 0x8b, 0xde, 0x63, 0x8f, 0xb8, 0xe8, 0xa2, 0x27, 0x21, 0x24, 0x74, 0x10, 0xde,
+    0xc5, 0xef, 0xf9, 0xcf, 0x94, 0xf9, 0x7e, 0xf8, 0x2d, 0xf9, 0xc8, 0x7f, 0xba, 0xdd, 0x85, 0xcf,
+    0x6c, 0xc2, 0xc4, 0xc4, 0x53, 0x64, 0x6c, 0xbf, 0x9c, 0x17, 0xfb, 0x77, 0x61, 0xe8, 0x7b, 0x1f,
+    0xc8, 0xea, 0x9d, 0x37, 0x45, 0x2b, 0x46, 0x88, 0xa7, 0x87, 0x70, 0x9c, 0x29, 0x62, 0xc4, 0x2e,
+    0x02, 0x84, 0x0c, 0x3b, 0x0e, 0x5d, 0x7e, 0x20, 0x36, 0xe0, 0x38, 0x71, 0x1c, 0x6b, 0x61, 0x2d,
+    0x2a, 0x60, 0x38, 0x96, 0x93, 0x3e, 0x36, 0x6c, 0xa3, 0x02, 0xd3, 0x4b, 0xd7, 0xbf, 0x85, 0xc9,
+    0x56, 0x0b, 0xdc, 0xb2, 0x86, 0xc3, 0x0e, 0x1a, 0x18, 0xf2, 0xbf, 0x71, 0x3a, 0x1a, 0xb6, 0x35,
+    0xc3, 0xfe, 0x45, 0x5c, 0x18, 0xc5, 0xf9, 0x00, 0x22, 0xec, 0x81, 0x61, 0x54, 0xc3, 0x45, 0x74,
+    0xf4, 0xad, 0x3d, 0x80, 0x45, 0x52, 0x2c, 0xd3, 0x02, 0x3a, 0x38, 0x29, 0x43, 0x2d, 0x29, 0x2f,
+    0xb9, 0x20, 0x05, 0x25, 0x26, 0x21, 0x78, 0x88, 0x2b, 0xc1, 0x04, 0x21, 0x06, 0xb1, 0xb0, 0x59,
+    0x09, 0x97, 0xa1, 0xa3, 0x0f, 0xd3, 0x5b, 0xfd, 0x41, 0x07, 0x9d, 0xed, 0xa1, 0xe3, 0x37, 0x7f,
+    0x17, 0x50, 0x6f, 0xc5, 0xe9, 0x30, 0x4d, 0x0d, 0xcc, 0x25, 0xf9, 0x4a, 0x5c, 0x4e, 0x41, 0x59,
+    0x0e, 0x24, 0x08, 0xfd, 0x2d, 0xb0, 0xa1, 0x50, 0xba, 0xec, 0x02, 0xd2, 0x6d, 0xcc, 0xae, 0x3f,
+    0x94, 0xfb, 0xb9, 0xf3, 0xbc, 0x00, 0x7b, 0x9c, 0x22, 0x30, 0xf2, 0x65, 0xcb, 0x34, 0x8c, 0x9f,
+    0x50, 0x17, 0xb5, 0x6e, 0x30, 0x6b, 0xe5, 0x8c, 0xb2, 0xfd, 0xb3, 0xd5, 0x2e, 0x51, 0x1f, 0xac,
+    0xfd, 0xdb, 0x8f, 0x18, 0xc8, 0x0e, 0xd9, 0x8e, 0x94, 0xec, 0x11, 0x2f, 0xaf, 0x5f, 0xd3, 0xd5,
+    0x3a, 0x9c, 0x9e, 0x58, 0x13, 0xcb, 0xe9, 0x2b, 0x01, 0xc0, 0x83, 0xd0, 0x14, 0x84, 0x6f, 0xf5,
+    0x2d, 0x47, 0xd5, 0xff, 0x0c, 0xa8, 0x8e, 0x60, 0x06, 0xe6, 0xd8, 0xd4, 0xc2, 0x4c, 0x4f, 0x0c,
+    0x07, 0x44, 0x37, 0x2c, 0x51, 0x18, 0xe2, 0x90, 0x3c, 0x23, 0x0e, 0xde, 0xb9, 0xc0, 0xe2, 0x89,
+    0x45, 0xfa, 0x93, 0x41, 0xd9, 0x9c, 0xc9, 0x97, 0xf0, 0xa9, 0xef, 0xfa, 0x3b, 0x96, 0x42, 0x9e,
+    0x9d, 0x9d, 0x95, 0xc0, 0xb8, 0x4b, 0x4b, 0x38, 0x00, 0xb0, 0x1d, 0x9b, 0xd8, 0x19, 0x9e, 0xee,
+    0x93, 0x77, 0x18, 0xe5, 0x9d, 0x7b, 0x09, 0x43, 0x58, 0x5e, 0x37, 0x29, 0xf0, 0xcf, 0x05, 0xe0,
+    0x0d, 0x66, 0x2b, 0x0a, 0x06, 0x39, 0xcc, 0x86, 0x80, 0x14, 0x7c, 0xe1, 0xdb, 0x77, 0x85, 0x11,
+    0x52, 0x49, 0x53, 0x54, 0x56, 0x19, 0x0a, 0x7c, 0x17, 0x64, 0xb7, 0x70, 0x41, 0x48, 0x79, 0x66,
+    0x6c, 0x1a, 0x6c, 0x5d, 0x7c, 0x37, 0x75, 0x5c, 0xf2, 0xe5, 0x1c, 0xe5, 0xba, 0x1c, 0x08, 0x64,
+    0x5d, 0x07, 0x6f, 0xa8, 0x7b, 0x37, 0x45, 0x4f, 0x18, 0xc4, 0xbf, 0x0e, 0xfa, 0x8d, 0xb8, 0x37,
+    0x24, 0xa4, 0x4b, 0xdc, 0x41, 0x01, 0xf6, 0x82, 0x6e, 0x40, 0x18, 0x2d, 0xa8, 0x42, 0x32, 0x79,
+    0x42, 0x16, 0xfc, 0x95, 0xef, 0xe2, 0xe2, 0xed, 0x62, 0x97, 0xae, 0x80, 0xad, 0x25, 0x04, 0x5b,
+    0xc2, 0xf2, 0xfd, 0x9c, 0x88, 0xae, 0x4d, 0x19, 0x59, 0x86, 0xd4, 0xe7, 0x30, 0xbe, 0xbb, 0xdb,
+    0x14, 0xc2, 0xdb, 0x86, 0x7a, 0xdd, 0x28, 0x38, 0xf2, 0xb7, 0x51, 0xd8, 0xce, 0xc3, 0xc8, 0x7e,
+    0x6e, 0xc1, 0xf9, 0x76, 0x31, 0x75, 0x97, 0x86, 0x64, 0x13, 0x4c, 0x55, 0xf3, 0x73, 0x1b, 0x5a,
+    0x31, 0x7f, 0xe7, 0xd9, 0x53, 0x97, 0x7a, 0x04, 0xb3, 0xee, 0x8a, 0x61, 0x9b, 0x02, 0x64, 0xec,
+    0x06, 0xd2, 0x50, 0xdb, 0x1d, 0x94, 0x7e, 0x16, 0x96, 0xdd, 0xee, 0xe8, 0x01, 0xb8, 0x55, 0x66,
+    0x3d, 0x26, 0xd5, 0x21, 0x77, 0x39, 0xc2, 0x0e, 0x54, 0x62, 0xc9, 0xb5, 0x23, 0x69, 0xc8, 0x01,
+    0xb1, 0x17, 0xb7, 0xd5, 0x6a, 0x16, 0x22, 0xae, 0x16, 0x3a, 0xf3, 0x6f, 0xf5, 0x52, 0x53, 0xaa,
+    0xed, 0xf7, 0x5d, 0x10, 0x52, 0xe7, 0x2e, 0xd6, 0xc5, 0x14, 0x05, 0x5b, 0x0c, 0x6b, 0x27, 0xb9,
+    0x21, 0x9e, 0x7b, 0xa7, 0xe4, 0xdb, 0xec, 0xa0, 0xb5, 0xa5, 0xf2, 0x8d, 0x88, 0x8b, 0x8c, 0x83,
+    0xa9, 0x05, 0xd7, 0x07, 0x04, 0x10, 0x4d, 0xd7, 0x10, 0xdd, 0x5d, 0xbc, 0x20, 0xae, 0x0a, 0x57,
+    0x84, 0xaa, 0xe8, 0xd2, 0x4a, 0x84, 0xa7, 0x36, 0x59, 0xec, 0x56, 0x07, 0xbb, 0x53, 0x31, 0xd6,
+    0xc5, 0x92, 0x08, 0x88, 0xeb, 0x48, 0x59, 0x77, 0x89, 0xa7, 0xf4, 0xf6, 0x53, 0xc1, 0xe2, 0xe3,
+    0xf9, 0xaf, 0x42, 0xb1, 0x79, 0x62, 0x8e, 0xf1, 0xb7, 0x94, 0xdc, 0x0d, 0xa6, 0xde, 0x81, 0xc4,
+    0x2a, 0x52, 0x93, 0x5c, 0xb0, 0x39, 0xcc, 0x08, 0x6b, 0xda, 0x58, 0xc9, 0x5e, 0x83, 0x90, 0x91,
+    0x70, 0xb9, 0x56, 0x41, 0x24, 0xa8, 0x54, 0xa2, 0x59, 0x13, 0xb1, 0x60, 0xe5, 0x63, 0x48, 0x46,
+    0x7d, 0x01, 0xb5, 0xc9, 0x25, 0x2e, 0xfa, 0x6e, 0x12, 0x3f, 0xba, 0x39, 0x73, 0x4e, 0xa2, 0xc0,
+    0xf9, 0x43, 0x0d, 0x4c, 0x02, 0x75, 0x79, 0x54, 0xda, 0x01, 0x77, 0xe6, 0xa8, 0x98, 0x1f, 0xd6,
+    0x17, 0xb1, 0x2a, 0xb8, 0x0a, 0x98, 0x5b, 0x86, 0xb7, 0x53, 0xc4, 0x7f, 0xef, 0x51, 0x81, 0x4a,
+    0x6e, 0x7b, 0x83, 0x45, 0x0d, 0xd9, 0x2b, 0xbc, 0x08, 0x56, 0x6f, 0x16, 0xaa, 0x10, 0x49, 0x98,
+    0x92, 0x96, 0x33, 0x9a, 0xe2, 0xa6, 0x7b, 0xe9, 0xfa, 0xcb, 0xeb, 0x03, 0xed, 0xf7, 0x4e, 0xe4,
+    0x92, 0xe7, 0x0f, 0x57, 0xf0, 0x9f, 0x5c, 0x5b, 0x1b, 0xfc, 0x25, 0x5a, 0x90, 0xc7, 0x13, 0x4d,
+    0xae, 0x12, 0x48, 0x2e, 0x0e, 0x4c, 0x57, 0x0e, 0x12, 0x95, 0x4e, 0x0c, 0x2b, 0x68, 0x36, 0x4b,
+    0xbb, 0xa8, 0x3f, 0x44, 0x38, 0x29, 0xff, 0x27, 0x72, 0x47, 0x16, 0xa8, 0xf8, 0x8f, 0x0d, 0x49,
+    0x93, 0x15, 0x9e, 0x88, 0xbc, 0xb5, 0x72, 0xe4, 0xca, 0x77, 0x6d, 0xe2, 0x31, 0x3f, 0x3b, 0x3e,
+    0xcd, 0xe4, 0x1c, 0x48, 0x06, 0x08, 0x43, 0x0f, 0x5e, 0xda, 0xa2, 0xc9, 0x4e, 0xc6, 0xe3, 0xb1,
+    0x2a, 0x4f, 0x0c, 0xe8, 0x57, 0x32, 0x35, 0xad, 0x6d, 0x31, 0x89, 0xdc, 0x97, 0xf2, 0x49, 0xcb,
+    0xa9, 0xcc, 0x5d, 0xb6, 0xd8, 0xb6, 0x61, 0x4b, 0xd4, 0x85, 0xed, 0x4b, 0x41, 0x95, 0x19, 0x2f,
+    0x5f, 0xf8, 0x5f, 0xbe, 0xa3, 0x75, 0xed, 0x71, 0xc4, 0x87, 0x9b, 0x53, 0x86, 0x93, 0xa5, 0xac,
+    0x1f, 0xc8, 0xf2, 0xc1, 0x83, 0xd5, 0x76, 0x40, 0xe2, 0xf7, 0x3f, 0x08, 0x31, 0x65, 0xb6, 0xf5,
+    0x91, 0xfa, 0x91, 0xb2, 0xa2, 0xbd, 0x99, 0xc6, 0x61, 0x2c, 0xd7, 0x4c, 0x43, 0x2a, 0x18, 0x17,
+    0x0e, 0x2e, 0xb4, 0xfd, 0xd0, 0x8d, 0xc0, 0xff, 0xf5, 0x6a, 0x92, 0xe1, 0x78, 0x7b, 0x04, 0xb3,
+    0x3e, 0xc3, 0xde, 0x8a, 0x7c, 0x0f, 0x2d, 0x7f, 0x1f, 0x66, 0x0b, 0xfa, 0x3d, 0x26, 0x01, 0x79,
+    0x50, 0x02, 0xfd, 0xbd, 0xc3, 0x54, 0xb4, 0xa4, 0x5d, 0xfa, 0x5f, 0xd0, 0x03, 0xf3, 0xaa, 0xe2,
+    0x5a, 0x77, 0x04, 0xca, 0x2d, 0xf5, 0xae, 0x0f, 0xd0, 0x7f, 0xd1, 0xf9, 0x3e, 0xfa, 0xab, 0x55,
+    0x71, 0x2f, 0x16, 0x2d, 0x3a, 0x90, 0xb4, 0xc1, 0x8a, 0x83, 0xac, 0x52, 0x06, 0x51, 0x4c, 0xed,
+    0xca, 0x00, 0xa5, 0x54, 0xb1, 0xdb, 0x3d, 0xff, 0x41, 0x55, 0xc8, 0x11, 0x82, 0x54, 0x72, 0xec,
+    0xf9, 0x5e, 0x71, 0x15, 0xde, 0xb1, 0x00, 0x70, 0x6d, 0x7d, 0xaa, 0xf5, 0x2e, 0x89, 0xef, 0xfb,
+    0xf0, 0xe4, 0x43, 0x26, 0xbe, 0xc6, 0x36, 0x2f, 0x6b, 0x72, 0x14, 0xfc, 0xff, 0x30, 0xfa, 0xcb,
+    0xab, 0x8a, 0x49, 0x26, 0xd2, 0x49, 0xba, 0x63, 0x10, 0x45, 0x90, 0x0e, 0xc1, 0xa5, 0x03, 0x2a,
+    0xf4, 0x23, 0xde, 0x3a, 0x3e, 0xdb, 0xa0, 0x53, 0x33, 0x40, 0x04, 0x07, 0x64, 0x2f, 0x6b, 0x53,
+    0x0c, 0xaa, 0xbd, 0x29, 0x70, 0x98, 0xe0, 0x99, 0x8a, 0x4a, 0x7d, 0xcb, 0x38, 0x9d, 0xb4, 0xf7,
+    0x62, 0x3a, 0x25, 0x57, 0x90, 0x5a, 0x68, 0x44, 0x65, 0x28, 0x6b, 0x2d, 0x93, 0x92, 0x68, 0xa2,
+    0xfd, 0xa2, 0xa2, 0xa7, 0x20, 0xd5, 0xa1, 0x66, 0x43, 0x99, 0xa3, 0xa8, 0x64, 0x0f, 0x69, 0x61,
+    0x2a, 0x72, 0x82, 0xf4, 0x10, 0xa0, 0x06, 0x83, 0xbe, 0xe3, 0xd4, 0xc6, 0xe7, 0x38, 0x75, 0x25,
+    0xb6, 0x9f, 0xca, 0xa8, 0x1a, 0x5d, 0x1f, 0xe1, 0x5e, 0x3a, 0xe3, 0x22, 0x76, 0x0d, 0x94, 0xa2,
+    0xa2, 0x73, 0x29, 0x5a, 0x2a, 0x11, 0xa3, 0xa3, 0x24, 0x90, 0xc3, 0xee, 0xd5, 0x47, 0xae, 0x11,
+    0x06, 0xb5, 0xf9, 0xb1, 0x11, 0xec, 0x54, 0x0f, 0x2e, 0x07, 0xaa, 0xb6, 0xa9, 0x0f, 0x4c, 0xfa,
+    0xea, 0xae, 0xe3, 0xd4, 0xbe, 0x3c, 0x34, 0xeb, 0xae, 0x5c, 0xc7, 0x1f, 0x81, 0x5a, 0x5d, 0xb1,
+    0x80, 0x6f, 0x03, 0x35, 0x9b, 0xd3, 0xf5, 0x30, 0xcf, 0xc2, 0xed, 0x1a, 0x70, 0x75, 0x45, 0x5e,
+    0x07, 0x01, 0xb8, 0x9c, 0x1d, 0xa4, 0xdb, 0x9d, 0xa5, 0x8b, 0x37, 0x5b, 0x88, 0x31, 0xa3, 0x31,
+    0xd9, 0xf0, 0x53, 0x9d, 0x49, 0x9f, 0xff, 0x35, 0xc9, 0x46, 0xad, 0xe3, 0xe8, 0xf4, 0x46, 0xd4,
+    0x8b, 0x8b, 0x87, 0x7e, 0x57, 0xc0, 0x5b, 0x84, 0x6d, 0xc8, 0x91, 0x0c, 0xf8, 0xaf, 0x61, 0x0e,
+    0x53, 0xa9, 0xd4, 0x7b, 0xa5, 0xde, 0x27, 0x45, 0xe7, 0x37, 0x31, 0x0c, 0xfa, 0xd9, 0x38, 0x35,
+    0xad, 0x76, 0xed, 0x42, 0xf7, 0x89, 0x89, 0xf9, 0xab, 0xc3, 0x0f, 0xb8, 0xf8, 0x4b, 0x53, 0xb3,
+    0x2a, 0xcd, 0x61, 0x98, 0x83, 0x58, 0xc7, 0xe5, 0x83, 0xa9, 0x42, 0x0c, 0xcc, 0x0d, 0x56, 0xd1,
+    0x17, 0x5b, 0xc4, 0x8a, 0x15, 0x37, 0x6a, 0x5c, 0x91, 0x85, 0xb9, 0x41, 0xf2, 0xa6, 0xd9, 0xd6,
+    0xaf, 0x54, 0xd4, 0x0b, 0x48, 0x88, 0x8c, 0xd2, 0xac, 0xc6, 0xb0, 0x5d, 0x6e, 0x3b, 0x6b, 0xa7,
+    0x07, 0x87, 0xf2, 0xf0, 0x90, 0xff, 0x12, 0xc0, 0x1d, 0x0d, 0x26, 0xd4, 0x85, 0xee, 0xbe, 0x02,
+    0x99, 0x69, 0x44, 0xc8, 0x8c, 0x8e, 0x78, 0x9d, 0x8e, 0x0c, 0x40, 0xa2, 0x20, 0x64, 0xac, 0x18,
+    0x3b, 0x28, 0x8f, 0x55, 0x5a, 0xd5, 0x2d, 0xf8, 0x3f, 0xd2, 0xc7, 0x9f, 0xa2, 0x7a, 0xcd, 0x89,
+    0x61, 0x93, 0x15, 0xd7, 0xae, 0xcd, 0x5f, 0xc8, 0xf8, 0x89, 0xbf, 0x1f, 0xf3, 0x17, 0xe2, 0xc5,
+    0x4e, 0x8d, 0x4d, 0x95, 0x45, 0x6e, 0x8c, 0x2a, 0x8b, 0x5d, 0x0a, 0x59, 0x28, 0x0d, 0xa9, 0x24,
+    0x8b, 0x49, 0x95, 0x15, 0xd5, 0x50, 0xea, 0xa8, 0x42, 0x0f, 0xa9, 0x42, 0x63, 0xad, 0x8e, 0x32,
+    0x5a, 0xed, 0x2a, 0xd4, 0x3a, 0x69, 0xab, 0x8c, 0x35, 0xaf, 0x99, 0xb1, 0x5a, 0x31, 0xdc, 0x9d,
+    0x0b, 0x8a, 0x91, 0xee, 0x4b, 0xbd, 0x35, 0x61, 0xb4, 0x58, 0xcd, 0x0c, 0xb6, 0x10, 0xe4, 0x40,
+    0x7a, 0x10, 0xe8, 0x20, 0xf5, 0xea, 0x99, 0xf5, 0x93, 0x88, 0x0a, 0xb7, 0xe4, 0x2c, 0xf6, 0xf5,
+    0x02, 0xdd, 0xfa, 0x51, 0xfe, 0x05, 0x7b, 0x49, 0x17, 0xf3, 0x74, 0x4a, 0x1b, 0x26, 0x10, 0x9f,
+    0x1a, 0xbb, 0x19, 0x43, 0x1a, 0x19, 0x3f, 0x21, 0xd3, 0x82, 0x5f, 0x38, 0x44, 0x7d, 0xf8, 0xd3,
+    0xe7, 0xa6, 0xa4, 0x16, 0xb3, 0x09, 0x62, 0xe4, 0xbd, 0x22, 0x3d, 0xdb, 0x62, 0x06, 0xe3, 0x51,
+    0x7f, 0xf8, 0x53, 0xe6, 0x94, 0x2c, 0x10, 0xa7, 0x3d, 0x0c, 0x6c, 0xd1, 0xb2, 0xac, 0x43, 0x7d,
+    0x19, 0xe9, 0x7c, 0xc8, 0xaa, 0xa5, 0x77, 0x95, 0xb9, 0xec, 0x75, 0xc7, 0x41, 0xf1, 0x04, 0x3f,
+    0x93, 0xcd, 0x66, 0x28, 0x46, 0xe6, 0xc0, 0xd8, 0xc8, 0x8c, 0xb6, 0x53, 0xda, 0x12, 0xe4, 0x3a,
+    0x1d, 0xea, 0xf2, 0x3a, 0x5d, 0xda, 0xa4, 0x35, 0x2a, 0x9e, 0xcd, 0x14, 0x0c, 0x4b, 0x0e, 0x9e,
+    0xa2, 0x00, 0x87, 0x3b, 0x30, 0x21, 0x91, 0xf8, 0x42, 0x40, 0x5a, 0x30, 0xbe, 0xd6, 0x78, 0x24,
+    0x08, 0xa0, 0x61, 0x3c, 0xac, 0x21, 0x57, 0x03, 0x4d, 0x20, 0x59, 0xcf, 0x71, 0x3a, 0x69, 0x57,
+    0x50, 0xe2, 0x9d, 0x32, 0x62, 0xa3, 0xd2, 0x15, 0x96, 0x58, 0x9f, 0xc9, 0x79, 0x5e, 0xe6, 0xc2,
+    0x49, 0xbb, 0x6e, 0x49, 0x3d, 0xc2, 0x51, 0x41, 0xb5, 0x51, 0xb6, 0x04, 0x24, 0x75, 0xa5, 0xf6,
+    0x83, 0x22, 0xe6, 0x4e, 0xbe, 0x56, 0x99, 0xfd, 0x51, 0xa3, 0xee, 0x1b, 0x4a, 0xd4, 0x23, 0x05,
+    0x6a, 0x2d, 0x66, 0x8d, 0x09, 0x23, 0x85, 0x0d, 0x4b, 0x76, 0xaa, 0xad, 0xf8, 0x88, 0x79, 0x4c,
+    0x25, 0x17, 0x19, 0x13, 0x47, 0xd1, 0xbf, 0xbc, 0x95, 0x2b, 0xcc, 0xf0, 0x60, 0xed, 0xeb, 0x72,
+    0xeb, 0xd8, 0x9a, 0x64, 0x36, 0x5b, 0x1b, 0x65, 0x7c, 0x81, 0xe8, 0x2f, 0x9b, 0xfa, 0x13, 0xd9,
+    0xd4, 0x71, 0x36, 0xb0, 0xcf, 0xb2, 0x44, 0x35, 0xad, 0x36, 0xd2, 0xe8, 0x3a, 0xd8, 0x5f, 0x76,
+    0xf5, 0x27, 0xb2, 0xab, 0x63, 0x2c, 0x40, 0x67, 0x55, 0xa2, 0x6e, 0xf8, 0x12, 0x76, 0x27, 0x87,
+    0x1d, 0x55, 0xa8, 0x36, 0xeb, 0xea, 0x13, 0xca, 0x8a, 0x1d, 0x10, 0xb4, 0x74, 0x61, 0xb7, 0x0b,
+    0xdd, 0xb0, 0x4f, 0x95, 0x3b, 0xe2, 0x80, 0x67, 0x70, 0x5b, 0x82, 0xc3, 0xd6, 0x00, 0x36, 0xa0,
+    0x0e, 0xab, 0x20, 0xfa, 0x29, 0x90, 0xf0, 0xed, 0xa0, 0x23, 0xba, 0x78, 0x0f, 0xc0, 0x8f, 0xaf,
+    0x79, 0x7a, 0x50, 0x99, 0x99, 0x4e, 0xf6, 0xd7, 0x41, 0xa5, 0x74, 0xb2, 0xf7, 0xf1, 0xda, 0x8a,
+    0x1d, 0xf6, 0x6d, 0x54, 0x50, 0x5b, 0xf8, 0xae, 0x7d, 0x5e, 0x71, 0x53, 0xa8, 0xe2, 0x7a, 0x4f,
+    0xd9, 0x05, 0x2d, 0xe0, 0x60, 0x50, 0x4c, 0x70, 0x4c, 0x7d, 0x26, 0x57, 0xca, 0xd8, 0xc0, 0xad,
+    0x8a, 0xd9, 0x59, 0xbe, 0x26, 0x00, 0x09, 0x5c, 0x51, 0x02, 0xa0, 0xa8, 0x25, 0xa9, 0x73, 0x4c,
+    0x2c, 0x14, 0xb4, 0x0b, 0x1e, 0x72, 0x97, 0xe9, 0xa2, 0x97, 0xb9, 0x62, 0x7c, 0x11, 0x2c, 0x19,
+    0xdd, 0x86, 0xe9, 0x7d, 0xe3, 0x5b, 0xea, 0x81, 0x20, 0x20, 0x1a, 0xba, 0x3e, 0xb6, 0xd1, 0x0c,
+    0x39, 0x3b, 0x4f, 0x14, 0x56, 0x5a, 0xed, 0xd2, 0x45, 0x45, 0x2f, 0x08, 0x91, 0x50, 0x11, 0x80,
+    0x7d, 0x2b, 0xf9, 0xad, 0x28, 0xd7, 0x5d, 0x86, 0x60, 0x30, 0x99, 0x28, 0x54, 0x0e, 0x23, 0xb2,
+    0x48, 0xb6, 0x17, 0x4c, 0xcc, 0x73, 0x75, 0x4b, 0xc3, 0xe5, 0x3a, 0x01, 0x56, 0x80, 0x89, 0x82,
+    0x2f, 0x3f, 0x20, 0x00, 0x07, 0x58, 0x11, 0x09, 0xa9, 0x00, 0xdb, 0xae, 0xfd, 0xd0, 0xe7, 0x56,
+    0x7e, 0xc5, 0xd1, 0x6a, 0xb1, 0x05, 0xbe, 0x47, 0x97, 0x19, 0x10, 0x0d, 0x58, 0xb6, 0x68, 0x13,
+    0x43, 0x2b, 0xc0, 0x16, 0x82, 0xa6, 0x3c, 0x3a, 0xb3, 0x0c, 0xe6, 0x81, 0x02, 0x0b, 0x73, 0xa2,
+    0xe6, 0x5b, 0x68, 0x44, 0xa2, 0xb5, 0x99, 0x1f, 0x91, 0x39, 0x45, 0x4a, 0x95, 0x12, 0x11, 0xa4,
+    0x54, 0x0b, 0x64, 0x63, 0x53, 0x64, 0xfb, 0xcb, 0xdd, 0x06, 0x6c, 0xec, 0x74, 0x45, 0xc2, 0xe7,
+    0x2e, 0xe1, 0x6f, 0x2f, 0xef, 0x5e, 0xd9, 0xad, 0x26, 0xf4, 0x7e, 0x94, 0x83, 0x9b, 0x8a, 0x90,
+    0x2f, 0x43, 0x53, 0xc5, 0x70, 0x09, 0x50, 0x81, 0x41, 0xc4, 0xd7, 0x0a, 0x04, 0xa2, 0x5f, 0x33,
+    0x1e, 0x58, 0xcd, 0x3b, 0x54, 0x64, 0x99, 0x08, 0x8c, 0xf3, 0x06, 0xac, 0x93, 0x11, 0xd8, 0xd8,
+    0x78, 0xe8, 0x06, 0xcd, 0x66, 0x33, 0x64, 0xa2, 0xff, 0xfc, 0x27, 0x7a, 0xdb, 0x30, 0x1b, 0xe9,
+    0x07, 0x71, 0xf7, 0xf8, 0x5e, 0x8d, 0x07, 0xd6, 0x17, 0xb0, 0x98, 0xd6, 0x22, 0xf4, 0x3a, 0x80,
+    0x53, 0x48, 0xbb, 0xc3, 0x9f, 0x0f, 0xf0, 0x56, 0xe4, 0x23, 0xc8, 0xbf, 0xad, 0x90, 0x26, 0xc0,
+    0x9e, 0x2e, 0x5d, 0x1c, 0x04, 0xaf, 0x69, 0x10, 0x9e, 0x86, 0xa2, 0xee, 0xdb, 0x6a, 0xfa, 0x5e,
+    0x33, 0xc1, 0x50, 0x08, 0x1c, 0x15, 0x83, 0x1c, 0x07, 0x46, 0xfd, 0xad, 0x7a, 0x98, 0xf4, 0x6e,
+    0x11, 0x25, 0x40, 0xbb, 0x29, 0x6d, 0xe8, 0xd7, 0x78, 0xbe, 0x5f, 0x9b, 0x4f, 0xc4, 0xa1, 0x47,
+    0x73, 0xda, 0x7c, 0xe5, 0xc5, 0x6f, 0x0b, 0x43, 0xd5, 0xb8, 0x81, 0xfd, 0x27, 0x61, 0xc8, 0xe8,
+    0x62, 0x07, 0x9b, 0xc3, 0x26, 0x66, 0x14, 0x77, 0xb7, 0x0c, 0xf6, 0x85, 0xc4, 0x4e, 0xb9, 0x81,
+    0x79, 0x9a, 0x5c, 0x84, 0x4d, 0x34, 0x45, 0x4d, 0x07, 0xbb, 0x01, 0x69, 0x16, 0x28, 0xad, 0x94,
+    0xed, 0x33, 0x1a, 0xe0, 0x05, 0x30, 0xfb, 0x97, 0x88, 0x1f, 0x22, 0x62, 0x91, 0x0d, 0x39, 0x88,
+    0x4b, 0x91, 0x3b, 0x90, 0x0e, 0x63, 0x1b, 0xec, 0x5d, 0x8c, 0x6f, 0x8b, 0xb9, 0x6d, 0x29, 0x7b,
+    0x1e, 0xd3, 0xcb, 0x17, 0xf0, 0xf5, 0x5a, 0xbb, 0x8a, 0xce, 0x5b, 0x5b, 0xc4, 0x4d, 0x05, 0xae,
+    0x0a, 0xf7, 0xee, 0xe1, 0x5a, 0x52, 0x8f, 0xa9, 0x52, 0x92, 0x9e, 0xce, 0x8f, 0x99, 0x20, 0xdc,
+    0x0a, 0x74, 0x54, 0x62, 0xd7, 0x85, 0x7c, 0xad, 0xa5, 0xa0, 0x25, 0x10, 0x6b, 0x8b, 0x7e, 0xa4,
+    0x88, 0xae, 0xb0, 0xa8, 0x23, 0x63, 0xca, 0xa7, 0x7b, 0xe7, 0xb5, 0x20, 0x56, 0x2a, 0xf0, 0x24,
+    0x70, 0x66, 0x0c, 0x27, 0x83, 0x62, 0x15, 0xa8, 0x15, 0x83, 0x8a, 0xf0, 0xa7, 0x80, 0xbc, 0xaf,
+    0x23, 0x84, 0x98, 0x37, 0x05, 0xf1, 0xd1, 0x82, 0x70, 0xea, 0xf8, 0xec, 0x39, 0x06, 0x2e, 0x89,
+    0x8b, 0x66, 0x73, 0x0d, 0x93, 0x39, 0xa5, 0x30, 0xb2, 0xf1, 0x6f, 0xa4, 0x22, 0x35, 0x0c, 0xe4,
+    0xc0, 0x15, 0xf6, 0x2d, 0xae, 0x5e, 0x37, 0x2b, 0xf2, 0xfa, 0x1c, 0x82, 0xa5, 0x3c, 0xe1, 0x0a,
+    0xc4, 0x4a, 0xd4, 0x6e, 0xb6, 0xb9, 0x33, 0x7c, 0x00, 0x9b, 0x75, 0xb9, 0x5a, 0x11, 0x37, 0x0d,
+    0x3d, 0x22, 0xf1, 0xb4, 0x94, 0x0e, 0x9d, 0x54, 0x82, 0x44, 0x28, 0x77, 0x83, 0x59, 0x9c, 0xe0,
+    0x69, 0x22, 0x97, 0xcf, 0xb4, 0x29, 0xa7, 0x51, 0xa9, 0xa6, 0xb6, 0x85, 0x82, 0x7e, 0x89, 0xbb,
+    0xd7, 0x75, 0x12, 0x89, 0x03, 0x0d, 0xfb, 0x5c, 0x06, 0x92, 0x6e, 0x9d, 0x6a, 0x64, 0x22, 0xc0,
+    0x53, 0x80, 0x43, 0xe5, 0x3b, 0xad, 0x96, 0xf0, 0x63, 0xc9, 0x77, 0x0f, 0x6b, 0x15, 0x96, 0xf4,
+    0xf9, 0xc7, 0x6f, 0xcb, 0xfb, 0x18, 0x93, 0xf7, 0xb9, 0x24, 0x7f, 0xad, 0x02, 0x64, 0xa8, 0x16,
+    0x61, 0x45, 0xfa, 0xf9, 0xdb, 0xdd, 0x46, 0xa5, 0x0f, 0xf0, 0x12, 0xd4, 0x72, 0x61, 0xb3, 0x49,
+    0x41, 0x7c, 0xe6, 0x39, 0xa2, 0x17, 0xb3, 0xc9, 0x39, 0xfd, 0xe5, 0x17, 0x6d, 0x58, 0x90, 0xb2,
+    0xe6, 0x87, 0x2c, 0x33, 0x6d, 0x6a, 0xf3, 0x59, 0xcc, 0xd8, 0xfd, 0xf1, 0x1b, 0xbd, 0xff, 0xac,
+    0x8b, 0x05, 0x80, 0x41, 0x11, 0x10, 0xe5, 0x25, 0x06, 0x60, 0x9c, 0x8a, 0x0c, 0x26, 0xa1, 0xfc,
+    0xc8, 0x30, 0xc1, 0x88, 0x07, 0x9b, 0xb1, 0x2b, 0xb1, 0x8d, 0x50, 0x06, 0x0b, 0x6d, 0x72, 0x26,
+    0xb7, 0x1e, 0xcd, 0x76, 0x61, 0x89, 0xfc, 0x2c, 0x71, 0x4d, 0xd1, 0xb7, 0x4c, 0xce, 0xff, 0xe3,
+    0x37, 0x41, 0xe7, 0x69, 0xdc, 0x72, 0xdf, 0xc9, 0x64, 0xfa, 0x71, 0x67, 0xdc, 0x02, 0x9d, 0xc5,
+    0xfc, 0x3e, 0x06, 0xc9, 0xb7, 0x03, 0xa0, 0x22, 0xc3, 0x8f, 0x61, 0x4b, 0x5d, 0x00, 0x5e, 0xcc,
+    0xf4, 0x63, 0xd8, 0x7c, 0x3b, 0x27, 0x20, 0x93, 0xeb, 0x27, 0x93, 0x27, 0x6d, 0xf7, 0x1d, 0x55,
+    0x96, 0x1f, 0xc3, 0x95, 0xba, 0x00, 0x3c, 0x97, 0xed, 0xc7, 0x80, 0x99, 0x46, 0x00, 0xc9, 0x64,
+    0xfa, 0x31, 0x40, 0xd2, 0x74, 0x0f, 0xfa, 0xfb, 0x5c, 0xcb, 0xb0, 0xb7, 0xbe, 0xeb, 0x2a, 0xf5,
+    0xe8, 0xf0, 0xeb, 0xee, 0xad, 0x66, 0x4f, 0x60, 0x6e, 0xb6, 0x4b, 0xfd, 0xa7, 0xe1, 0x9a, 0xc0,
+    0x2a, 0x36, 0x9b, 0xb3, 0xd3, 0xdf, 0x03, 0xbe, 0xc1, 0xd3, 0x81, 0xe0, 0xed, 0xd6, 0xbd, 0x93,
+    0xab, 0x71, 0x19, 0x62, 0x89, 0xf9, 0x2c, 0xad, 0xf6, 0x6c, 0xfe, 0xed, 0xbe, 0xa6, 0x2b, 0xa6,
+    0xf8, 0x5a, 0x81, 0x8a, 0xf0, 0x7c, 0xae, 0xa8, 0x35, 0xc7, 0xd8, 0xb4, 0x60, 0x9f, 0xc0, 0xb7,
+    0x00, 0x41, 0x62, 0x6b, 0x6d, 0xd5, 0xf2, 0x2e, 0x73, 0x7b, 0x2d, 0xb2, 0xd8, 0x14, 0x13, 0x64,
+    0x71, 0xc3, 0x31, 0xc8, 0xf2, 0x46, 0xcb, 0x51, 0x06, 0x92, 0xdb, 0x82, 0x39, 0x1f, 0x83, 0xbb,
+    0x64, 0xe4, 0x09, 0xc5, 0xa5, 0x1e, 0x0d, 0xfa, 0x24, 0xa3, 0xd3, 0xce, 0x91, 0x77, 0x8e, 0x64,
+    0x82, 0x7c, 0xf3, 0xd1, 0xd8, 0x53, 0xaf, 0x8a, 0x31, 0x27, 0x0d, 0x1a, 0x9c, 0xb9, 0xdc, 0x6e,
+    0xcb, 0x9f, 0xd7, 0x7e, 0xe5, 0x41, 0x92, 0x57, 0xf6, 0x3b, 0xcd, 0xf8, 0x6c, 0xe0, 0xcf, 0x0c,
+    0xcf, 0x78, 0xa3, 0x6a, 0x60, 0x6d, 0xf5, 0x16, 0xe2, 0x61, 0x90, 0x7a, 0x31, 0xdf, 0x77, 0x66,
+    0xf7, 0xee, 0xe7, 0x8a, 0xed, 0x78, 0x1a, 0x8d, 0x2b, 0xbd, 0xa7, 0x86, 0x1b, 0xf0, 0x7c, 0xe0,
+    0xf9, 0x0d, 0x74, 0xf0, 0xe5, 0x83, 0x78, 0x84, 0xb5, 0x9a, 0x4b, 0x97, 0x2e, 0xaf, 0x61, 0xe9,
+    0x80, 0x00, 0xa1, 0x4c, 0xf8, 0xf2, 0x41, 0x1a, 0xcd, 0x8a, 0x0d, 0xbf, 0x22, 0x03, 0x16, 0x6f,
+    0xf3, 0x5c, 0x13, 0x5c, 0x4a, 0xd0, 0xcd, 0x9e, 0xf8, 0xd0, 0x83, 0xa4, 0x84, 0x2f, 0xfa, 0xf1,
+    0x27, 0x75, 0x2e, 0x93, 0x5f, 0x89, 0x0a, 0xdc, 0xb7, 0xcf, 0x6b, 0xf2, 0x9f, 0x7a, 0xee, 0xd1,
+    0xfc, 0xc7, 0x28, 0x12, 0xfe, 0x93, 0x86, 0x5a, 0xfc, 0x67, 0xa0, 0x9b, 0x3d, 0xf1, 0x21, 0xe1,
+    0x3f, 0xfa, 0xf4, 0x3d, 0xf9, 0x2f, 0x59, 0xe3, 0xb1, 0x52, 0xc8, 0x23, 0x4a, 0x64, 0x51, 0x6c,
+    0x86, 0x14, 0x64, 0x02, 0x9c, 0x9a, 0x53, 0x55, 0xf7, 0x2f, 0x5a, 0x51, 0xc1, 0x3a, 0x24, 0x80,
+    0x22, 0xc7, 0xff, 0x5e, 0xd2, 0x50, 0x84, 0xc7, 0xa3, 0x05, 0x52, 0xc2, 0x95, 0xc8, 0xa4, 0xdc,
+    0x53, 0xcb, 0x50, 0x54, 0xc3, 0x9a, 0xbd, 0x7c, 0x6b, 0x8f, 0x61, 0x1a, 0xc8, 0xcd, 0x7f, 0xb1,
+    0x07, 0x92, 0x6a, 0xc2, 0x1e, 0x2c, 0xba, 0x5e, 0x2f, 0x4a, 0x19, 0xce, 0x8b, 0xcd, 0x10, 0x29,
+    0x5f, 0xf1, 0xba, 0xf3, 0x0d, 0x76, 0x5b, 0x1c, 0xa4, 0xc3, 0x6f, 0xfb, 0xe4, 0xaf, 0x14, 0xc5,
+    0x05, 0xe4, 0xa8, 0x68, 0x7c, 0xd1, 0x93, 0x5f, 0xa7, 0x71, 0xc1, 0x9f, 0x34, 0x8f, 0x0a, 0xca,
+    0xf2, 0x81, 0xe5, 0xb4, 0xa0, 0x7c, 0x61, 0xd3, 0x1b, 0x24, 0xb2, 0xda, 0x59, 0x43, 0x3c, 0xd0,
+    0xda, 0x98, 0xe7, 0x26, 0xbe, 0x58, 0x9b, 0x73, 0xf4, 0x91, 0x60, 0xf9, 0xcd, 0x18, 0x57, 0xd4,
+    0x83, 0xa4, 0x17, 0xbd, 0x26, 0xd8, 0x41, 0x92, 0x6d, 0x98, 0x0e, 0x20, 0x0a, 0x43, 0xac, 0x39,
+    0xfa, 0x44, 0x19, 0x71, 0x49, 0x10, 0x94, 0xbe, 0x4c, 0x03, 0x3a, 0xd3, 0xc9, 0x7b, 0x30, 0x7b,
+    0x44, 0x58, 0x2f, 0x4b, 0xd9, 0x05, 0x7f, 0xe4, 0x6f, 0x8e, 0x94, 0x54, 0x46, 0xcf, 0x6d, 0x16,
+    0xe9, 0xcc, 0x40, 0x64, 0x1f, 0x44, 0x29, 0x80, 0x15, 0x41, 0x17, 0xfe, 0x97, 0x06, 0xa2, 0x36,
+    0xbc, 0x89, 0x2f, 0xc3, 0x37, 0xe6, 0xea, 0x1d, 0xd6, 0x85, 0xd8, 0xe0, 0xf0, 0xdd, 0xc7, 0xac,
+    0x11, 0x87, 0xd4, 0x46, 0x61, 0xc6, 0xd7, 0x1c, 0x04, 0x10, 0x3c, 0xdf, 0x10, 0xb6, 0x22, 0xde,
+    0xf2, 0x0e, 0x71, 0x40, 0xe0, 0x4d, 0x8c, 0x9d, 0xab, 0xf1, 0xca, 0x99, 0x05, 0x11, 0x25, 0xbc,
+    0xd9, 0x0b, 0xab, 0x32, 0x7d, 0x87, 0x15, 0xb9, 0x81, 0xb2, 0x85, 0xa4, 0x59, 0x43, 0x54, 0x91,
+    0x1a, 0x68, 0x8e, 0xde, 0xbd, 0x78, 0x01, 0x73, 0xc9, 0x31, 0x0a, 0xb6, 0x53, 0x61, 0x57, 0x35,
+    0xfd, 0x91, 0x72, 0x8c, 0x43, 0xb3, 0x4e, 0x8e, 0xcf, 0x78, 0x3f, 0x7a, 0xe3, 0xdb, 0xa4, 0xbe,
+    0x0c, 0x4b, 0x38, 0x73, 0x32, 0x14, 0xbd, 0x7f, 0xa4, 0x0c, 0x33, 0xd7, 0x82, 0xf7, 0x88, 0xb0,
+    0x1a, 0x52, 0x3a, 0xd6, 0x60, 0x7e, 0x75, 0x17, 0xc8, 0x7b, 0xb2, 0x2f, 0x99, 0xbf, 0xdb, 0xa2,
+    0xc9, 0x04, 0x1c, 0x67, 0xa0, 0x01, 0xcf, 0x21, 0x17, 0x2a, 0xd1, 0xd6, 0x0e, 0x2e, 0xd6, 0xc3,
+    0xf9, 0x60, 0x62, 0x0d, 0xfb, 0xfd, 0x49, 0x1f, 0x82, 0xdb, 0xab, 0x80, 0x0b, 0x1b, 0xe4, 0xf5,
+    0x02, 0x83, 0x3a, 0xb0, 0x07, 0x93, 0x0c, 0xf7, 0x0d, 0xee, 0x0f, 0x46, 0x67, 0x67, 0x16, 0x0c,
+    0x86, 0xc0, 0x40, 0xd0, 0x9b, 0xe5, 0xa7, 0x35, 0x65, 0x10, 0xae, 0x6a, 0x0c, 0x1d, 0x4f, 0x26,
+    0xe6, 0x60, 0xc8, 0xe7, 0x7d, 0x4b, 0x97, 0x6b, 0x98, 0x2f, 0x40, 0xa2, 0x1e, 0xb1, 0xf6, 0x77,
+    0x01, 0xa9, 0x33, 0xb5, 0x31, 0x1e, 0x98, 0x86, 0x09, 0xe3, 0x3f, 0xd0, 0x6b, 0x1a, 0x62, 0x74,
+    0xb5, 0xa6, 0x6e, 0x9d, 0x79, 0xc7, 0xd6, 0xb8, 0xdf, 0xe7, 0x2b, 0xc3, 0xd3, 0x35, 0xa3, 0xfc,
+    0x5e, 0xfa, 0x9a, 0x30, 0xee, 0xb2, 0xd7, 0xb5, 0x38, 0x1e, 0x8f, 0xcd, 0xfe, 0xc8, 0xe2, 0x64,
+    0x3f, 0xa1, 0x36, 0xf6, 0x20, 0xe4, 0xb9, 0x2e, 0xc5, 0x9b, 0xa0, 0x0e, 0xc5, 0xd6, 0x78, 0x38,
+    0x1e, 0x4f, 0xf8, 0xcc, 0xd8, 0x25, 0x0b, 0x98, 0x9f, 0xdc, 0xea, 0x87, 0x29, 0x4c, 0xac, 0xaa,
+    0xf9, 0x70, 0x9b, 0x0a, 0xd9, 0x6e, 0x19, 0xee, 0xc0, 0x17, 0x62, 0xb3, 0x1a, 0xf7, 0x1f, 0xd1,
+    0xac, 0xc6, 0xd6, 0x64, 0x64, 0x9c, 0x71, 0xf5, 0x3c, 0xb1, 0x61, 0x1d, 0x79, 0x83, 0xdd, 0x1b,
+    0xc2, 0xea, 0x08, 0x78, 0xd4, 0x1f, 0x0f, 0xcf, 0xac, 0x33, 0x18, 0xf8, 0x1b, 0x66, 0xec, 0x0e,
+    0xfd, 0x13, 0x64, 0x55, 0xcf, 0x12, 0xc7, 0xc3, 0x09, 0xb7, 0xc4, 0x37, 0xfe, 0x1a, 0x6f, 0x36,
+    0xd8, 0x86, 0xf1, 0xb0, 0x68, 0xd4, 0x32, 0xc5, 0x81, 0x31, 0x19, 0x0c, 0x47, 0xdc, 0x8a, 0x31,
+    0x75, 0xc9, 0x1d, 0xfa, 0x3b, 0xa9, 0x33, 0xe5, 0x78, 0x34, 0x1a, 0x0d, 0x4c, 0x2b, 0x66, 0xf1,
+    0xc3, 0x8e, 0x7e, 0x45, 0xcf, 0x28, 0xfe, 0x5a, 0x8b, 0xc9, 0xc9, 0x78, 0x72, 0x36, 0xe6, 0xd4,
+    0x82, 0xf1, 0x63, 0x08, 0x8d, 0x2f, 0x08, 0x73, 0xf1, 0x2e, 0xf4, 0x6b, 0x59, 0xfe, 0xd9, 0x68,
+    0x74, 0x36, 0x14, 0x12, 0x0a, 0xb0, 0xb7, 0xfb, 0xfa, 0x15, 0x6f, 0xc0, 0x12, 0xaf, 0xd6, 0x3e,
+    0x59, 0x3c, 0x86, 0x3d, 0x15, 0x9a, 0x8a, 0x1f, 0x33, 0x96, 0x90, 0x3c, 0xa3, 0x5f, 0x5c, 0x97,
+    0xe3, 0x27, 0xc7, 0xd3, 0xc5, 0x21, 0xd8, 0x13, 0x08, 0xc5, 0xc3, 0x85, 0x8d, 0xfd, 0xc6, 0x97,
+    0x7d, 0xcc, 0xb6, 0xd2, 0x06, 0xfb, 0xf3, 0x37, 0x20, 0x1b, 0xec, 0xc6, 0xb9, 0x08, 0xf7, 0xd0,
+    0x7e, 0xc5, 0x80, 0xfa, 0x4b, 0xe0, 0xc3, 0x97, 0x43, 0xdd, 0xd2, 0x98, 0x4f, 0xdc, 0x75, 0x0b,
+    0x64, 0xba, 0x79, 0xad, 0x5e, 0x20, 0x75, 0x8b, 0xa5, 0x66, 0x96, 0xdc, 0x92, 0x09, 0xdb, 0x23,
+    0xed, 0x6a, 0x19, 0x4f, 0xad, 0x5b, 0x2f, 0x6b, 0x58, 0xdd, 0xf7, 0x13, 0x61, 0x29, 0x9f, 0xd7,
+    0x49, 0xf1, 0x49, 0x04, 0x98, 0xa6, 0xb4, 0x47, 0x88, 0x52, 0x3f, 0xdb, 0x01, 0xd2, 0x84, 0x15,
+    0xe4, 0x71, 0xa4, 0x59, 0xd1, 0x5d, 0xd5, 0x95, 0x4d, 0xb3, 0x93, 0x87, 0x9a, 0xf7, 0xf8, 0xd6,
+    0x15, 0xf1, 0x02, 0x9f, 0x49, 0x53, 0x38, 0xc0, 0xb3, 0x12, 0xfd, 0xc6, 0x8f, 0x8c, 0xd6, 0x70,
+    0xaf, 0x79, 0x4d, 0xfd, 0xcf, 0xd1, 0x7b, 0x5e, 0x0c, 0x13, 0x35, 0xff, 0x88, 0xbc, 0xfa, 0x3a,
+    0xe5, 0x34, 0x72, 0xba, 0xf2, 0xf5, 0xb4, 0x46, 0x4e, 0x2e, 0xbc, 0xb9, 0x31, 0x7f, 0xeb, 0x87,
+    0x90, 0xa2, 0x86, 0x10, 0xe0, 0x88, 0x5d, 0xc7, 0xba, 0xeb, 0x39, 0x40, 0x7d, 0x26, 0xff, 0xe1,
+    0x86, 0x0c, 0x5f, 0xf1, 0xf2, 0xdc, 0xf1, 0x5c, 0xa6, 0xd5, 0xbd, 0xef, 0xcf, 0xe1, 0xe1, 0x46,
+    0x59, 0x23, 0xc5, 0x49, 0xed, 0x34, 0x3e, 0x03, 0xd0, 0x66, 0x3a, 0xfd, 0x79, 0x54, 0xaa, 0x44,
+    0x32, 0x8b, 0x96, 0x7b, 0x52, 0xbd, 0xc9, 0x96, 0xa6, 0xd9, 0xb7, 0x0c, 0xe4, 0x36, 0xd3, 0x99,
+    0xea, 0xe7, 0x01, 0x2b, 0xc7, 0xad, 0x90, 0x7b, 0x7d, 0xfd, 0xa5, 0x57, 0x82, 0x12, 0xfd, 0x89,
+    0xc7, 0x56, 0xc4, 0x51, 0x92, 0xdd, 0x40, 0x10, 0xe6, 0x08, 0xe4, 0x69, 0x9b, 0x55, 0x14, 0x75,
+    0x84, 0x7d, 0xcc, 0x1a, 0x99, 0x53, 0x45, 0xaf, 0x31, 0x7f, 0x3c, 0xe3, 0x3d, 0x96, 0x8d, 0xdc,
+    0xd5, 0xa4, 0x02, 0x27, 0x8e, 0x13, 0x5d, 0x6d, 0xd2, 0x72, 0x93, 0x3f, 0xd2, 0xfc, 0xbf, 0x60,
+    0x28, 0x7b, 0x55, 0xaa, 0xcc, 0x8f, 0xe8, 0xd5, 0xb2, 0x93, 0x3b, 0x8c, 0x7d, 0x14, 0x6e, 0x1e,
+    0xc5, 0xf3, 0x2e, 0x7a, 0x51, 0x2e, 0x57, 0x91, 0xe1, 0xc9, 0xef, 0xba, 0x69, 0xd4, 0x75, 0xd9,
+    0x0a, 0x57, 0x8d, 0xd6, 0x62, 0x99, 0x61, 0x1c, 0xea, 0xa8, 0xfc, 0x5e, 0xef, 0x3e, 0x3f, 0x4d,
+    0xc8, 0xed, 0x9a, 0xaa, 0xd0, 0xc7, 0x37, 0x46, 0xaf, 0x79, 0x49, 0x8f, 0x47, 0x3e, 0x78, 0xbf,
+    0x4f, 0xc2, 0x79, 0x94, 0x96, 0x0e, 0xe5, 0x7b, 0x46, 0xf8, 0xe3, 0x53, 0xe8, 0x03, 0xaf, 0x23,
+    0x1e, 0x81, 0xb8, 0xaf, 0x43, 0xcc, 0x11, 0x52, 0x6f, 0x75, 0x04, 0xca, 0x41, 0x15, 0xca, 0xa3,
+    0xb8, 0x1f, 0xee, 0xe3, 0x5e, 0x08, 0xf6, 0x08, 0xc4, 0xa3, 0x4a, 0x4d, 0x1d, 0xc7, 0xfe, 0x58,
+    0x87, 0x33, 0xad, 0xe2, 0x1d, 0x4b, 0xee, 0x64, 0x3f, 0xea, 0x92, 0x1d, 0x3c, 0xbe, 0x93, 0x4a,
+    0xa8, 0xf8, 0x53, 0x54, 0x6d, 0x15, 0x05, 0xd6, 0x1f, 0xb2, 0xfe, 0xab, 0xde, 0xd7, 0xc9, 0x5b,
+    0x05, 0x15, 0xc5, 0xd6, 0x18, 0x20, 0xb9, 0x66, 0xb0, 0xa7, 0x20, 0x16, 0xc3, 0xa7, 0x97, 0x11,
+    0x8c, 0xec, 0xe5, 0x03, 0xa3, 0x7c, 0xd9, 0xc0, 0xa8, 0x89, 0xb1, 0x78, 0x99, 0xc0, 0xc8, 0x5f,
+    0x1b, 0x30, 0x94, 0xb7, 0x13, 0xea, 0x22, 0x57, 0xdc, 0x2f, 0x30, 0x0a, 0xd7, 0x08, 0xcc, 0xdc,
+    0x9d, 0x81, 0xcc, 0xd6, 0xec, 0x5e, 0xbf, 0x8d, 0x2e, 0xa8, 0xeb, 0x42, 0x7e, 0xd7, 0x57, 0x06,
+    0x74, 0x3b, 0x4f, 0x8a, 0xef, 0x9f, 0xa8, 0x43, 0x93, 0x72, 0xfa, 0x27, 0xb2, 0xe8, 0x5e, 0x62,
+    0x70, 0x4f, 0xf4, 0xf2, 0x1f, 0xaf, 0xc4, 0x9d, 0x98, 0x27, 0xef, 0x61, 0x23, 0xb3, 0xe4, 0x25,
+    0xf7, 0xd0, 0x47, 0xe1, 0x9a, 0xa0, 0xe7, 0x57, 0xef, 0xfb, 0x16, 0xaf, 0x2a, 0x30, 0x3f, 0xda,
+    0xf0, 0xb8, 0x84, 0x09, 0xd0, 0xa7, 0xe9, 0x47, 0xff, 0x06, 0x7e, 0x05, 0xbb, 0x45, 0x20, 0xeb,
+    0x8a, 0xb0, 0x3a, 0xc9, 0xb1, 0x6f, 0x5f, 0xbe, 0xb4, 0x0c, 0xc3, 0xe8, 0xf5, 0xe1, 0x17, 0xba,
+    0xe2, 0x5f, 0xc5, 0x21, 0xea, 0xb0, 0x6e, 0xbc, 0x47, 0x7a, 0x46, 0x02, 0xba, 0xf2, 0x7a, 0x02,
+    0xd3, 0x4e, 0xc6, 0xff, 0xf7, 0xcc, 0xff, 0x1d, 0x98, 0xb9, 0xe8, 0x6d, 0x33, 0xf4, 0x63, 0xb4,
+    0x66, 0xc4, 0x99, 0x35, 0xd6, 0x61, 0xb8, 0x0d, 0xa6, 0xbd, 0xde, 0x8a, 0x86, 0xeb, 0xdd, 0xe2,
+    0x74, 0xe9, 0x6f, 0x7a, 0xbc, 0xe8, 0xf5, 0xce, 0xfb, 0xb8, 0xa6, 0x41, 0x8f, 0x58, 0xd7, 0x5d,
+    0xd2, 0xbf, 0xee, 0x46, 0x54, 0x34, 0x50, 0x88, 0xc1, 0x3f, 0xc2, 0x59, 0xe3, 0xdf, 0x0b, 0x17,
+    0x7b, 0x90, 0x72, 0xbd, 0xa4, 0xe1, 0x6f, 0xbb, 0x05, 0xfa, 0x40, 0xc4, 0x03, 0xaf, 0x3e, 0xbb,
+    0xbb, 0xe8, 0xe1, 0x58, 0x82, 0xb1, 0xcc, 0x60, 0xe3, 0x24, 0xce, 0x39, 0xc0, 0x9b, 0xc4, 0xb7,
+    0x8b, 0xff, 0x17, 0x3a, 0xe4, 0x7d, 0xad, 0x6e, 0x5c, 0x00, 0x00,
+};
+
+#endif
@@ -51,7 +51,9 @@
  * MAIN OPERATION LOOP:
  * ====================
  * 
- * The loop() function performs continuous monitoring and control:
+ * The loop() function hands control to the tickless run loop (RunLoop.h): it
+ * sleeps until an E-stop/limit switch edge, a periodic job or a state timer
+ * is due, then does only that work:
  * 
  * 1. STATE MACHINE EXECUTION:
  *    - Call runStateMachine() to process current bridge state
@@ -135,12 +137,43 @@
 TrafficModule trafficLight (Pin_TrafficRed, Pin_TrafficYellow, Pin_TrafficGreen);
 Sonic sonic1 (Pin_SonicTrigger_1, Pin_SonicEcho_1);
 Sonic sonic2 (Pin_SonicTrigger_2, Pin_SonicEcho_2);
-Sonic sonicSensor (Pin_SonicTrigger_1, Pin_SonicEcho_1); // Primary sensor for boat detection
+Sonic& sonicSensor = sonic1; // Primary sensor for boat detection (shares sonic1's echo interrupt)
 Motor motor (Pin_DIR1, Pin_DIR2);
 
 
 //bridgeState currentState;
 
+// Run loop jobs (see RunLoop.h)
+static int sensorLogJob = -1;
+
+void ioJob(uint32_t nowMs) {
+    webPage_commands();     // the web server itself runs in its own task
+    
+    // Process configuration commands from Serial
+    if (Serial.available()) {
+        String command = Serial.readStringUntil('\n');
+        command.trim();
+        if (command == "journal") {
+            journal.dump();
+        } else {
+            bridgeConfig.processConfigCommand(command);
+        }
+        runLoop.setPeriod(sensorLogJob, bridgeConfig.getDebugLogInterval());
+    }
+}
+
+void sensorLog(uint32_t nowMs) {
+    debugLogSensors(captureSensors());
+}
+
+// Sample every sensor once; the state machine runs on that frame and its
+// outputs go to the pins together at the end of the pass
+void statePass(uint32_t nowMs) {
+    stateMachine(captureSensors());
+    outputs.commit();
+    webPage_publish(nowMs);     // after commit, so the page never runs ahead of the pins
+}
+
 void setup(){
     Serial.begin(115200);
     
@@ -154,37 +187,25 @@ void setup(){
     webPage_init();
     sonic1.init();
     sonic2.init();
-    sonicSensor.init();
     motor.init();
 
     currentState = lowered;
     debugLog("System initialized - bridge state set to LOWERED");
-    debugLogSensors();
-    
-    server.handleClient();
+    debugLogSensors(captureSensors());
+
+    // Safety inputs wake the loop the moment they change
+    runLoop.watch(Pin_EStop);
+    runLoop.watch(Pin_LS_1);
+    runLoop.watch(Pin_LS_2);
+    runLoop.every(Loop_IoPollMs, ioJob);
+    runLoop.every(Loop_SonicPingMs, sonicService, true);
+    sensorLogJob = runLoop.every(bridgeConfig.getDebugLogInterval(), sensorLog);
+    runLoop.onPass(statePass, stateMachineDeadline);
+    runLoop.begin();
 }
 
 void loop() {
-    server.handleClient();
-    
-    // Process configuration commands from Serial
-    if (Serial.available()) {
-        String command = Serial.readStringUntil('\n');
-        bridgeConfig.processConfigCommand(command);
-    }
-    
-    // Run the state machine with current state
-    stateMachine(currentState);
-    
-    // Periodic debug sensor logging using configurable interval
-    static unsigned long lastDebugLog = 0;
-    unsigned long debugInterval = bridgeConfig.getDebugLogInterval();
-    
-    if (millis() - lastDebugLog >= debugInterval) {
-        debugLogSensors();
-        lastDebugLog = millis();
-    }
-    
-    // Small delay to prevent overwhelming the system
-    delay(50);
-}
\ No newline at end of file
+    // Sleeps until an input edge or the next job/state deadline, then runs
+    // exactly what is due. Replaces the old fixed delay(50).
+    runLoop.runOnce();
+}
@@ -8,6 +8,9 @@
 #include "SonicSensor.h"
 #include "TrafficLight.h"
 #include "BridgeConfig.h"
+#include "RunLoop.h"
+#include "GpioShadow.h"
+#include "Journal.h"
 
 #define Pin_PhotoCell        4
 #define Pin_DIR2            12
@@ -32,6 +35,9 @@
 #define MotorSpeed_Slow
 
 #define WebServer_PollingRate   1000 //ms
+#define WebServer_Port          80
+#define Loop_IoPollMs           50   // web commands + serial commands (the server itself runs in its own task)
+#define Loop_SonicPingMs        60   // HC-SR04 wants >= 60ms between pings
 #define WebServer_SSID          "ESP32WA8"
 #define WebServer_Password      "12345678"
 
@@ -0,0 +1,189 @@
+// Microbenchmark harness for the host benchmarks (bench_*.cpp).
+//
+// Each case runs in batches that double until one takes BENCH_BATCH_MS; the
+// best of BENCH_REPEATS such batches gives ns/op (best, because a busy
+// machine only ever adds time). One more batch is run with the allocation
+// counters below armed, for allocations and bytes per op. The counters
+// replace the global operator new, so include this from the benchmark's main
+// file only.
+//
+// Options, for every benchmark built on this:
+//   --save FILE       write this run as a baseline
+//   --baseline FILE   compare with a baseline; exit 1 if a case is more than
+//                     --tolerance percent slower (default 25), and at least
+//                     BENCH_FLOOR_NS, or allocates more
+//   --filter TEXT     only run cases whose name contains TEXT
+//
+// Baselines are tab-separated "name, ns/op, allocs/op, bytes/op" lines, '#'
+// for comments. ns/op only means something against a baseline from the same
+// machine; allocations are exact and compare anywhere. Note the host String
+// is std::string, whose inline buffer is not the same size as the ESP32
+// String's, so the board can allocate a little more or less for short text.
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define BENCH_BATCH_MS  20
+#define BENCH_REPEATS   5
+#define BENCH_FLOOR_NS  5       // slower by less than this is timer noise, whatever the %
+
+namespace bench {
+    // Plain statics: operator new can run before any constructor does
+    static bool counting = false;
+    static uint64_t allocs = 0;
+    static uint64_t allocBytes = 0;
+
+    // Stops the compiler dropping a result nobody reads
+    template <class T> inline void keep(const T& v) { asm volatile("" : : "g"(&v) : "memory"); }
+}
+
+static void* benchAlloc(size_t n) {
+    if (bench::counting) { bench::allocs++; bench::allocBytes += n; }
+    void* p = malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+void* operator new(size_t n) { return benchAlloc(n); }
+void* operator new[](size_t n) { return benchAlloc(n); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+class Bench {
+    public:
+        struct Result {
+            std::string name;
+            double ns;
+            double allocs;
+            double bytes;
+        };
+
+        Bench(int argc, char** argv) {
+            for (int i = 1; i < argc; i++) {
+                std::string a = argv[i];
+                bool hasValue = i + 1 < argc;
+                if (a == "--save" && hasValue) savePath = argv[++i];
+                else if (a == "--baseline" && hasValue) basePath = argv[++i];
+                else if (a == "--tolerance" && hasValue) tolerancePct = atof(argv[++i]);
+                else if (a == "--filter" && hasValue) filter = argv[++i];
+                else {
+                    fprintf(stderr, "usage: %s [--save FILE] [--baseline FILE] [--tolerance PCT] [--filter TEXT]\n", argv[0]);
+                    exit(2);
+                }
+            }
+            printf("%-40s %10s %10s %10s\n", "case", "ns/op", "allocs/op", "bytes/op");
+        }
+
+        // Time fn(), one call per op
+        template <class F> void run(const char* name, F fn) {
+            if (!filter.empty() && !strstr(name, filter.c_str())) return;
+            for (int i = 0; i < 100; i++) fn();
+
+            uint64_t n = 1;
+            double batchNs = timeBatch(fn, n);
+            while (batchNs < BENCH_BATCH_MS * 1e6 && n < (1ULL << 30)) {
+                n *= 2;
+                batchNs = timeBatch(fn, n);
+            }
+            double best = batchNs;
+            for (int r = 1; r < BENCH_REPEATS; r++) {
+                double t = timeBatch(fn, n);
+                if (t < best) best = t;
+            }
+
+            uint64_t counted = n < 10000 ? n : 10000;
+            bench::allocs = bench::allocBytes = 0;
+            bench::counting = true;
+            for (uint64_t i = 0; i < counted; i++) fn();
+            bench::counting = false;
+
+            Result r{ name, best / n, (double)bench::allocs / counted, (double)bench::allocBytes / counted };
+            results.push_back(r);
+            printf("%-40s %10.1f %10.2f %10.1f\n", r.name.c_str(), r.ns, r.allocs, r.bytes);
+        }
+
+        // Save and/or compare; the return value is the process exit code
+        int finish() {
+            if (!savePath.empty()) save();
+            if (basePath.empty()) return 0;
+            return compare();
+        }
+
+    private:
+        std::vector<Result> results;
+        std::string savePath, basePath, filter;
+        double tolerancePct = 25;
+
+        template <class F> static double timeBatch(F& fn, uint64_t n) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < n; i++) fn();
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        }
+
+        void save() const {
+            FILE* f = fopen(savePath.c_str(), "w");
+            if (!f) {
+                fprintf(stderr, "%s: cannot write\n", savePath.c_str());
+                exit(2);
+            }
+            fprintf(f, "# name\tns/op\tallocs/op\tbytes/op\n");
+            for (const Result& r : results) fprintf(f, "%s\t%.1f\t%.2f\t%.1f\n", r.name.c_str(), r.ns, r.allocs, r.bytes);
+            fclose(f);
+            printf("baseline saved to %s\n", savePath.c_str());
+        }
+
+        int compare() const {
+            std::ifstream in(basePath);
+            if (!in) {
+                fprintf(stderr, "%s: cannot read\n", basePath.c_str());
+                return 2;
+            }
+            std::vector<Result> base;
+            std::string line;
+            while (std::getline(in, line)) {
+                if (line.empty() || line[0] == '#') continue;
+                std::istringstream fields(line);
+                Result r;
+                std::string ns, allocs, bytes;
+                std::getline(fields, r.name, '\t');
+                std::getline(fields, ns, '\t');
+                std::getline(fields, allocs, '\t');
+                std::getline(fields, bytes, '\t');
+                r.ns = atof(ns.c_str());
+                r.allocs = atof(allocs.c_str());
+                r.bytes = atof(bytes.c_str());
+                base.push_back(r);
+            }
+
+            printf("\nagainst %s (tolerance %.0f%%, at least %d ns):\n", basePath.c_str(), tolerancePct, BENCH_FLOOR_NS);
+            int regressions = 0;
+            for (const Result& r : results) {
+                const Result* b = nullptr;
+                for (const Result& x : base) if (x.name == r.name) b = &x;
+                if (!b) {
+                    printf("  %-40s new\n", r.name.c_str());
+                    continue;
+                }
+                // On a case of a few ns a percentage is all noise, so the
+                // allowance never drops below BENCH_FLOOR_NS
+                double allowNs = b->ns * tolerancePct / 100;
+                if (allowNs < BENCH_FLOOR_NS) allowNs = BENCH_FLOOR_NS;
+                bool slower = r.ns - b->ns > allowNs;
+                bool allocates = r.allocs > b->allocs + 0.005 || r.bytes > b->bytes + 0.5;
+                printf("  %-40s %+6.0f%%  allocs %+.2f  bytes %+.1f%s\n", r.name.c_str(),
+                       b->ns > 0 ? (r.ns / b->ns - 1) * 100 : 0.0, r.allocs - b->allocs, r.bytes - b->bytes,
+                       slower || allocates ? "  REGRESSION" : "");
+                regressions += slower || allocates;
+            }
+            if (regressions) printf("%d regression(s)\n", regressions);
+            return regressions ? 1 : 0;
+        }
+};
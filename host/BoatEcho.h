@@ -0,0 +1,117 @@
+// Boat traffic and HC-SR04 echo model for the host simulators.
+//
+// The channel is one axis, x in mm, boats travelling towards +x. The bridge
+// span covers [spanFromMm, spanToMm]. A boat holds at its waiting line until
+// the span is open (as the skipper would) and then carries on through; if a
+// hull is ever inside the span while it is not open, that is a strike.
+//
+// Each sonar is a trigger/echo pin pair at some x. It either looks down the
+// channel towards -x (range to the nearest bow in front of it) or straight
+// across it (range to a hull in the beam). With nothing in view it hears the
+// far bank at wallMm, or nothing if wallMm is 0. A falling edge on the
+// trigger pin schedules the echo pulse on the echo pin, HC-SR04 style: a
+// ~450us burst delay, then HIGH for the round-trip time, or a 38ms pulse when
+// there is no echo.
+#pragma once
+#include <vector>
+#include "Arduino.h"
+
+struct SonarSpec {
+    uint8_t trigPin;
+    uint8_t echoPin;
+    float xMm;
+    bool  across;           // true: across the channel, false: down it (-x)
+    float acrossMm;         // range to a hull in the beam / alongside
+    float wallMm;           // range when nothing is in view, 0 = no echo
+};
+
+struct Boat {
+    float bowMm;            // bow position
+    float lengthMm;
+    float speedMmS;
+    float waitAtMm;         // bow holds here until the span is open
+    bool  struck = false;
+    bool  passed = false;
+};
+
+class BoatEcho {
+    public:
+        typedef bool (*OpenFn)();   // span open enough to pass under
+
+        BoatEcho(float spanFromMm, float spanToMm, OpenFn open)
+            : spanFrom(spanFromMm), spanTo(spanToMm), openFn(open) {}
+
+        void addSonar(const SonarSpec& s) { sonars.push_back(s); }
+        void addBoat(const Boat& b) { boats.push_back(b); }
+
+        void attach(uint32_t periodUs = 1000) {
+            lastUs = hal_nowUs();
+            for (SonarSpec& s : sonars) hal_watchOutput(s.trigPin, trigFn, this);
+            hal_addModel(periodUs, stepFn, this);
+        }
+
+        const std::vector<Boat>& fleet() const { return boats; }
+        uint32_t strikes() const { uint32_t n = 0; for (const Boat& b : boats) n += b.struck; return n; }
+        uint32_t passed() const { uint32_t n = 0; for (const Boat& b : boats) n += b.passed; return n; }
+        uint32_t pings() const { return pingCount; }
+
+        // What sonar i would hear right now, in mm (0 = no echo)
+        float rangeMm(size_t i) const {
+            const SonarSpec& s = sonars[i];
+            float best = 0;
+            for (const Boat& b : boats) {
+                float stern = b.bowMm - b.lengthMm;
+                float r = 0;
+                if (stern <= s.xMm && b.bowMm >= s.xMm) r = s.acrossMm;         // in the beam / alongside
+                else if (!s.across && b.bowMm < s.xMm) r = s.xMm - b.bowMm;     // coming towards it
+                if (r > 0 && r <= MaxRangeMm && (best == 0 || r < best)) best = r;
+            }
+            return best ? best : s.wallMm;
+        }
+
+    private:
+        static constexpr float MaxRangeMm = 4000.0f;
+        static constexpr uint32_t BurstUs = 450;
+        static constexpr uint32_t NoEchoUs = 38000;
+
+        float spanFrom, spanTo;
+        OpenFn openFn;
+        std::vector<SonarSpec> sonars;
+        std::vector<Boat> boats;
+        std::vector<int> trigLevel;
+        uint64_t lastUs = 0;
+        uint32_t pingCount = 0;
+
+        static void stepFn(uint64_t nowUs, void* self) { ((BoatEcho*)self)->step(nowUs); }
+        static void trigFn(uint8_t pin, int value, void* self) { ((BoatEcho*)self)->trig(pin, value); }
+
+        void step(uint64_t nowUs) {
+            float dt = (nowUs - lastUs) / 1e6f;
+            lastUs = nowUs;
+            bool open = openFn();
+            for (Boat& b : boats) {
+                float next = b.bowMm + b.speedMmS * dt;
+                if (!open && b.bowMm <= b.waitAtMm && next > b.waitAtMm) next = b.waitAtMm;
+                b.bowMm = next;
+                float stern = b.bowMm - b.lengthMm;
+                if (!open && b.bowMm > spanFrom && stern < spanTo) b.struck = true;
+                if (stern > spanTo) b.passed = true;
+            }
+        }
+
+        void trig(uint8_t pin, int value) {
+            if (trigLevel.size() < sonars.size()) trigLevel.resize(sonars.size(), LOW);
+            for (size_t i = 0; i < sonars.size(); i++) {
+                if (sonars[i].trigPin != pin) continue;
+                bool falling = trigLevel[i] == HIGH && value == LOW;
+                trigLevel[i] = value;
+                if (!falling) continue;
+                pingCount++;
+                float r = rangeMm(i);
+                uint64_t rise = hal_nowUs() + BurstUs;
+                uint32_t width = r > 0 ? (uint32_t)(r * 2000.0f / 343.0f) : NoEchoUs;
+                hal_schedulePin(rise, sonars[i].echoPin, HIGH);
+                hal_schedulePin(rise + width, sonars[i].echoPin, LOW);
+            }
+        }
+};
@@ -0,0 +1,98 @@
+// Bridge plant model for the host simulators.
+//
+// The span is lifted by a string wound onto the motor pulley. Geometry from
+// Documentation/BridgeMovement.txt: 40mm pulley, 1:1, three motor rotations
+// for a full lift, so the string travels 3 * pi * 40 = ~377mm from fully
+// down to fully up. Position is that string travel in mm.
+//
+// The motor is a first-order model: speed follows duty (0..255, signed by
+// direction) towards duty/255 * rpmFull with time constant tauMs. The end
+// stops are hard: driving into one stalls the motor there, and the time
+// spent doing so is counted, since that is what a late stop costs on the
+// real rig. Each limit switch closes within switchZoneMm of its end stop
+// and is written to its pin through the HAL, so the sketch's ISR sees it.
+#pragma once
+#include <math.h>
+#include "Arduino.h"
+
+struct PlantConfig {
+    float pulleyMm      = 40.0f;
+    float liftRotations = 3.0f;
+    float rpmFull       = 60.0f;    // no-load speed at duty 255 (assumed)
+    float tauMs         = 80.0f;    // motor + span spin-up
+    float switchZoneMm  = 3.0f;
+    float startMm       = 0.0f;     // where the span starts (0 = down)
+};
+
+// How the switches are wired: pin and the level it reads when pressed
+struct LimitWiring {
+    uint8_t topPin;
+    uint8_t botPin;
+    int pressedLevel;
+};
+
+class BridgePlant {
+    public:
+        // Reads the motor command as a signed duty (+ = raising), -255..255
+        typedef int (*DriveFn)();
+
+        BridgePlant(const PlantConfig& c, LimitWiring w, DriveFn drive)
+            : cfg(c), wiring(w), driveFn(drive), pos(c.startMm) {
+            travel = cfg.liftRotations * (float)M_PI * cfg.pulleyMm;
+        }
+
+        // Register with the HAL; the plant then steps itself as time moves
+        void attach(uint32_t periodUs = 1000) {
+            lastUs = hal_nowUs();
+            writeSwitches(true);
+            hal_addModel(periodUs, stepFn, this);
+        }
+
+        float travelMm() const { return travel; }
+        float positionMm() const { return pos; }
+        float openFraction() const { return pos / travel; }
+        bool atTop() const { return pos >= travel - cfg.switchZoneMm; }
+        bool atBottom() const { return pos <= cfg.switchZoneMm; }
+        float speedMmS() const { return speed; }
+        uint64_t stallUs() const { return stall; }
+        uint32_t fullLifts() const { return lifts; }
+
+    private:
+        PlantConfig cfg;
+        LimitWiring wiring;
+        DriveFn driveFn;
+        float travel;
+        float pos;
+        float speed = 0;            // mm/s of string, + = raising
+        uint64_t lastUs = 0;
+        uint64_t stall = 0;
+        uint32_t lifts = 0;
+        bool top = false, bot = false;
+
+        static void stepFn(uint64_t nowUs, void* self) { ((BridgePlant*)self)->step(nowUs); }
+
+        void step(uint64_t nowUs) {
+            float dt = (nowUs - lastUs) / 1e6f;
+            lastUs = nowUs;
+            float mmPerRev = (float)M_PI * cfg.pulleyMm;
+            float target = driveFn() / 255.0f * cfg.rpmFull / 60.0f * mmPerRev;
+            speed += (target - speed) * (1.0f - expf(-dt * 1000.0f / cfg.tauMs));
+            pos += speed * dt;
+            if (pos > travel || pos < 0) {
+                if (fabsf(target) > 0) stall += (uint64_t)(dt * 1e6f);
+                pos = pos > travel ? travel : 0;
+                speed = 0;
+            }
+            writeSwitches(false);
+        }
+
+        void writeSwitches(bool force) {
+            bool t = atTop(), b = atBottom();
+            int open = !wiring.pressedLevel;
+            if (force || t != top) hal_setPin(wiring.topPin, t ? wiring.pressedLevel : open);
+            if (force || b != bot) hal_setPin(wiring.botPin, b ? wiring.pressedLevel : open);
+            if (t && !top) lifts++;
+            top = t;
+            bot = b;
+        }
+};
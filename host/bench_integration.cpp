@@ -0,0 +1,97 @@
+// Hot-path microbenchmarks for the Integration sketch: one Main_tick() in
+// each state, and loop()'s side of the web server: draining an empty command
+// ring, publishing a state the page already has (the server itself is
+// host/http_load's), and the /state JSON as the http task renders it.
+//
+// The FSM is BridgeCore<SimHw>. Each state is reached with a short script of
+// frames and then ticked on a frame that keeps it there (time frozen, so no
+// timeout fires). PREP_LOW always moves on, so it is timed as the
+// UP -> PREP_LOW -> UP round trip a waiting boat causes.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -pthread -Ihal -I../Integration bench_integration.cpp hal/Arduino.cpp ../Integration/main.cpp ../Integration/InputEvents.cpp ../Integration/EchoCapture.cpp ../Integration/Webpage.cpp ../Integration/HttpTask.cpp ../Integration/HttpSite.cpp -o bench_integration
+//   ./bench_integration [--baseline bench_integration.baseline] [--save FILE]
+
+#include "Bench.h"
+#include "Arduino.h"
+#include "Config.h"
+#include "Hardware.h"
+#include "BridgeCore.h"
+#include "InputEvents.h"
+#include "Webpage.h"
+
+typedef BridgeCore<BridgeHw> Core;
+
+static InputEvents inputs(PIN_LIM_TOP, PIN_LIM_BOT, PIN_ESTOP, PIN_BTN_RAISE, PIN_BTN_LOWER, PIN_BTN_ABORT);
+static const MainConfig cfg;
+
+static void tick(const SensorFrame& f, bool raise = false, bool lower = false, bool abort = false) {
+    Main_tick(f, raise, lower, abort);
+}
+
+// Ticks on f until the FSM is in want; the script below is wrong if it never gets there
+static void reach(State want, const SensorFrame& f, bool raise = false, bool lower = false) {
+    for (int i = 0; i < 4 && Core::state() != want; i++) tick(f, raise, lower);
+    if (Core::state() != want) {
+        fprintf(stderr, "could not reach state %d (in %d)\n", want, Core::state());
+        exit(2);
+    }
+}
+
+int main(int argc, char** argv) {
+    Bench b(argc, argv);
+    hal_serialMute(true);
+    Main_init(&inputs, nullptr, nullptr, cfg);
+
+    SensorFrame f;
+    f.tMs = 1000;
+    tick(f);
+    b.run("Main_tick DOWN", [&] { tick(f); });
+
+    reach(PREP_RAISE, f, true);
+    b.run("Main_tick PREP_RAISE", [&] { tick(f); });
+
+    f.tMs += cfg.T_YELLOW;
+    reach(RAISING, f);
+    b.run("Main_tick RAISING", [&] { tick(f); });
+
+    f.estop = true;
+    reach(EMERG_LOWER, f);
+    f.estop = false;
+    b.run("Main_tick EMERG_LOWER", [&] { tick(f); });
+
+    f.bot = true;
+    reach(DOWN, f);
+    f.bot = false;
+    reach(PREP_RAISE, f, true);
+    f.tMs += cfg.T_YELLOW;
+    reach(RAISING, f);
+    f.top = true;
+    reach(UP, f);
+    f.top = false;
+    f.boatWaiting = true;
+    b.run("Main_tick UP", [&] { tick(f); });
+    b.run("Main_tick UP<->PREP_LOW", [&] { tick(f, false, true); });
+
+    f.boatWaiting = false;
+    reach(LOWERING, f, false, true);
+    b.run("Main_tick LOWERING", [&] { tick(f); });
+
+    f.boatUnder = true;
+    reach(EMERG_RAISE, f);
+    b.run("Main_tick EMERG_RAISE", [&] { tick(f); });
+
+    b.run("Webpage_poll", [] { Webpage_poll(); });
+    Webpage_publish(millis());
+    b.run("Webpage_publish unchanged", [] { Webpage_publish(millis()); });
+    // renderState() in HttpTask.cpp, into a buffer its size; every field at its longest
+    ControlState page = { true, true, true, true, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+    static char stateBody[HttpSite_StateBytes];
+    b.run("/state JSON", [&] {
+        JsonWriter json(stateBody, sizeof(stateBody));
+        json.object(httpStateSchema, httpStateFieldCount, &page);
+        bench::keep(json);
+    });
+
+    return b.finish();
+}
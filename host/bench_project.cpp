@@ -0,0 +1,70 @@
+// Microbenchmarks for MidSem/Project's web responses that are built as JSON:
+// the /state body the http task renders once per ControlState (renderState()
+// in HttpTask.cpp), and the /metrics body it writes from a WebReply
+// (httpSite_reply(), i.e. LoopStats::json()). Both go into buffers of the
+// sizes HttpTask.cpp gives them: /state with every field at its longest,
+// /metrics with passes spread over 16 histogram buckets.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -Ihal -I../MidSem/Project bench_project.cpp hal/Arduino.cpp ../MidSem/Project/HttpSite.cpp ../MidSem/Project/LoopStats.cpp -o bench_project
+//   ./bench_project [--baseline bench_project.baseline] [--save FILE]
+
+#include "Bench.h"
+#include "Arduino.h"
+#include "HttpTask.h"
+
+// A buffer that came up short is a bug in its size, not a slow case
+static void mustFit(const char* name, const JsonWriter& json) {
+    if (!json.ok()) {
+        fprintf(stderr, "%s: %u bytes did not fit\n", name, (unsigned)json.length());
+        exit(2);
+    }
+}
+
+int main(int argc, char** argv) {
+    Bench b(argc, argv);
+
+    ControlState state;
+    state.state = emergencyRaise;
+    state.streetLight = true;
+    state.boat = true;
+    state.trafficLight = 2;
+    state.sonic1 = DistanceMM(UINT16_MAX);
+    state.sonic2 = DistanceMM(UINT16_MAX);
+    state.gpioWrites = UINT32_MAX;
+    state.gpioElided = UINT32_MAX;
+    state.nextState = "Next State";
+    static char stateBody[HttpSite_StateBytes];
+    JsonWriter check(stateBody, sizeof(stateBody));
+    check.object(httpStateSchema, httpStateFieldCount, &state);
+    mustFit("/state", check);
+    b.run("/state JSON", [&] {
+        JsonWriter json(stateBody, sizeof(stateBody));
+        json.object(httpStateSchema, httpStateFieldCount, &state);
+        bench::keep(json);
+    });
+
+    // One pass per bucket per phase: pass i takes 2^i us in each phase
+    static WebReply reply;
+    reply.ticket = 1;
+    reply.stats.begin();
+    for (uint8_t i = 0; i < 16; i++) {
+        reply.stats.passStart();
+        for (uint8_t p = 0; p < Phase_Count; p++) {
+            hal_advanceTo(hal_nowUs() + (1ULL << i));
+            reply.stats.mark((LoopPhase)p);
+        }
+        reply.stats.passEnd();
+    }
+    static char replyBody[HttpSite_ReplyBytes];
+    JsonWriter fit(replyBody, sizeof(replyBody));
+    httpSite_reply(fit, reply);
+    mustFit("/metrics", fit);
+    b.run("httpSite_reply /metrics", [] {
+        JsonWriter json(replyBody, sizeof(replyBody));
+        httpSite_reply(json, reply);
+        bench::keep(json);
+    });
+
+    return b.finish();
+}
@@ -0,0 +1,96 @@
+// Hot-path microbenchmarks for MidSem/ProjectTest: one stateMachine() pass
+// in each state (journal and all, as on the board), loop()'s side of the
+// web server (draining an empty command ring, and publishing a state the
+// page already has; the server itself is host/http_load's), the /state JSON
+// as the http task renders it, serial config commands and getStateName().
+//
+// Each state is reached with a short script of frames and then passed a
+// frame that keeps it there, with time frozen so no timer fires.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -pthread -Ihal -I../MidSem/ProjectTest bench_projecttest.cpp hal/Arduino.cpp ../MidSem/ProjectTest/*.cpp -o bench_projecttest
+//   ./bench_projecttest [--baseline bench_projecttest.baseline] [--save FILE]
+
+#include "Bench.h"
+#include "Arduino.h"
+#include "main.h"
+
+// Passes f until the machine is in want; the script below is wrong if it never gets there
+static void reach(bridgeState want, const SensorFrame& f) {
+    for (int i = 0; i < 4 && currentState != want; i++) stateMachine(f);
+    if (currentState != want) {
+        fprintf(stderr, "could not reach %s (in %s)\n", getStateName(want), getStateName(currentState));
+        exit(2);
+    }
+}
+
+int main(int argc, char** argv) {
+    Bench b(argc, argv);
+    hal_serialMute(true);
+    bridgeConfig.resetToDefaults();
+    motor.init();
+
+    const DistanceMM boat = DistanceMM(bridgeConfig.getBoatDetectionDistance().mm() - 10);
+    const DistanceMM clear = DistanceMM(bridgeConfig.getAreaClearDistance().mm() + 10);
+    SensorFrame f = SensorFrame();
+    f.timeMs = 1000;
+    f.sonicConfidence = 100;
+    f.sonic = clear;
+    stateMachine(f);
+    b.run("stateMachine lowered", [&] { stateMachine(f); });
+
+    f.sonic = boat;
+    reach(prepareRaise, f);
+    b.run("stateMachine prepareRaise", [&] { stateMachine(f); });
+
+    f.timeMs += bridgeConfig.getActionDelay();
+    reach(raising, f);
+    b.run("stateMachine raising", [&] { stateMachine(f); });
+
+    f.eStop = true;
+    reach(emergencyLower, f);
+    f.eStop = false;
+    b.run("stateMachine emergencyLower", [&] { stateMachine(f); });
+
+    f.bottomLimit = true;
+    reach(lowered, f);
+    f.bottomLimit = false;
+    reach(prepareRaise, f);
+    f.timeMs += bridgeConfig.getActionDelay();
+    reach(raising, f);
+    f.topLimit = true;
+    reach(raised, f);
+    b.run("stateMachine raised", [&] { stateMachine(f); });
+
+    f.topLimit = false;
+    f.sonic = clear;
+    reach(prepareLower, f);
+    b.run("stateMachine prepareLower", [&] { stateMachine(f); });
+
+    f.timeMs += bridgeConfig.getActionDelay();
+    reach(lowering, f);
+    b.run("stateMachine lowering", [&] { stateMachine(f); });
+
+    f.eStop = true;
+    reach(emergencyRaise, f);
+    b.run("stateMachine emergencyRaise", [&] { stateMachine(f); });
+
+    b.run("webPage_commands", [] { webPage_commands(); });
+    webPage_publish(f.timeMs);
+    b.run("webPage_publish unchanged", [&] { webPage_publish(f.timeMs); });
+    // renderState() in HttpTask.cpp, into a buffer its size
+    ControlState page = { currentState, getStateName(currentState) };
+    static char stateBody[HttpSite_StateBytes];
+    b.run("/state JSON", [&] {
+        JsonWriter json(stateBody, sizeof(stateBody));
+        json.object(httpStateSchema, httpStateFieldCount, &page);
+        bench::keep(json);
+    });
+    b.run("processConfigCommand set", [] { bridgeConfig.processConfigCommand("action_delay=3000"); });
+    b.run("processConfigCommand show", [] { bridgeConfig.processConfigCommand("show"); });
+    b.run("getStateName", [] {
+        for (uint8_t s = lowered; s <= emergencyRaise; s++) bench::keep(getStateName((bridgeState)s));
+    });
+
+    return b.finish();
+}
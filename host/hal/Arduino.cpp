@@ -0,0 +1,181 @@
+#include "Arduino.h"
+#include <map>
+#include <vector>
+
+HardwareSerial Serial;
+
+namespace {
+    struct PinState {
+        int level = LOW;        // what digitalRead() sees
+        int out = 0;            // last digitalWrite/analogWrite
+        bool analogOut = false; // out came from analogWrite
+        int analog = 0;
+        uint8_t mode = INPUT;
+        bool driven = false;    // the world has set this input
+        void (*isr)() = nullptr;
+        void (*isrArg)(void*) = nullptr;
+        void* arg = nullptr;
+        int edge = 0;
+        void (*watch)(uint8_t, int, void*) = nullptr;
+        void* watchArg = nullptr;
+    };
+    struct PinChange { uint8_t pin; int level; };
+    struct Model {
+        uint32_t periodUs;
+        uint64_t dueUs;
+        void (*fn)(uint64_t, void*);
+        void* arg;
+    };
+
+    uint64_t nowUs = 0;
+    PinState pins[HAL_PINS];
+    std::multimap<uint64_t, PinChange> script;
+    std::vector<Model> models;
+    bool serialMuted = false;
+    std::string serialIn;
+
+    void applyPin(uint8_t pin, int level) {
+        if (pin >= HAL_PINS) return;
+        PinState& p = pins[pin];
+        p.driven = true;
+        int was = p.level;
+        p.level = level ? HIGH : LOW;
+        if (was == p.level) return;
+        bool fire = p.edge == CHANGE || (p.edge == RISING && p.level) || (p.edge == FALLING && !p.level);
+        if (!fire) return;
+        if (p.isrArg) p.isrArg(p.arg);
+        else if (p.isr) p.isr();
+    }
+}
+
+uint64_t hal_nowUs() { return nowUs; }
+
+// Scripted pin changes and model steps are interleaved in time order; a
+// model step due at the same instant as a pin change runs first.
+void hal_advanceTo(uint64_t us, volatile bool* stopWhenSet) {
+    for (;;) {
+        Model* m = nullptr;
+        for (Model& c : models) if (!m || c.dueUs < m->dueUs) m = &c;
+        bool pinDue = !script.empty() && script.begin()->first <= us;
+        bool modelDue = m && m->dueUs <= us;
+        if (!pinDue && !modelDue) break;
+
+        if (modelDue && (!pinDue || m->dueUs <= script.begin()->first)) {
+            if (m->dueUs > nowUs) nowUs = m->dueUs;
+            m->dueUs += m->periodUs;
+            m->fn(nowUs, m->arg);
+        } else {
+            auto it = script.begin();
+            if (it->first > nowUs) nowUs = it->first;
+            PinChange c = it->second;
+            script.erase(it);
+            applyPin(c.pin, c.level);
+        }
+        if (stopWhenSet && *stopWhenSet) return;
+    }
+    if (us > nowUs) nowUs = us;
+}
+
+void hal_setPin(uint8_t pin, int level) { applyPin(pin, level); }
+void hal_schedulePin(uint64_t atUs, uint8_t pin, int level) { script.insert({ atUs, PinChange{ pin, level } }); }
+void hal_setAnalog(uint8_t pin, int value) { if (pin < HAL_PINS) pins[pin].analog = value; }
+int  hal_output(uint8_t pin) { return pin < HAL_PINS ? pins[pin].out : 0; }
+int  hal_duty(uint8_t pin) {
+    if (pin >= HAL_PINS) return 0;
+    return pins[pin].analogOut ? pins[pin].out : (pins[pin].out ? 255 : 0);
+}
+void hal_watchOutput(uint8_t pin, void (*fn)(uint8_t, int, void*), void* arg) {
+    if (pin >= HAL_PINS) return;
+    pins[pin].watch = fn;
+    pins[pin].watchArg = arg;
+}
+void hal_addModel(uint32_t periodUs, void (*fn)(uint64_t, void*), void* arg) {
+    models.push_back(Model{ periodUs, nowUs + periodUs, fn, arg });
+}
+void hal_serialMute(bool mute) { serialMuted = mute; }
+void hal_serialFeed(const char* text) { serialIn += text; }
+
+unsigned long millis() { return (unsigned long)(uint32_t)(nowUs / 1000); }
+unsigned long micros() { return (unsigned long)(uint32_t)nowUs; }
+void delay(unsigned long ms) { hal_advanceTo(nowUs + (uint64_t)ms * 1000); }
+void delayMicroseconds(unsigned int us) { hal_advanceTo(nowUs + us); }
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= HAL_PINS) return;
+    pins[pin].mode = mode;
+    if (mode == INPUT_PULLUP && !pins[pin].driven) pins[pin].level = HIGH;
+}
+static void writeOut(uint8_t pin, int value, bool analog) {
+    if (pin >= HAL_PINS) return;
+    PinState& p = pins[pin];
+    p.out = value;
+    p.analogOut = analog;
+    if (p.watch) p.watch(pin, value, p.watchArg);
+}
+void digitalWrite(uint8_t pin, uint8_t level) { writeOut(pin, level ? HIGH : LOW, false); }
+// Like the ESP32, reading back an output gives the level being driven
+int  digitalRead(uint8_t pin) {
+    if (pin >= HAL_PINS) return LOW;
+    if (pins[pin].mode == OUTPUT) return pins[pin].analogOut ? pins[pin].out > 127 : pins[pin].out;
+    return pins[pin].level;
+}
+int  analogRead(uint8_t pin) { return pin < HAL_PINS ? pins[pin].analog : 0; }
+void analogWrite(uint8_t pin, int value) { writeOut(pin, value, true); }
+
+// Blocking measurement, as on the board: waits for the pulse to start, then
+// for it to end, moving virtual time in 1us steps. 0 on timeout.
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeoutUs) {
+    uint64_t limit = nowUs + timeoutUs;
+    while (digitalRead(pin) == state) { if (nowUs >= limit) return 0; hal_advanceTo(nowUs + 1); }
+    while (digitalRead(pin) != state) { if (nowUs >= limit) return 0; hal_advanceTo(nowUs + 1); }
+    uint64_t rise = nowUs;
+    while (digitalRead(pin) == state) { if (nowUs >= limit) return 0; hal_advanceTo(nowUs + 1); }
+    return (unsigned long)(nowUs - rise);
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
+    if (pin >= HAL_PINS) return;
+    pins[pin].isr = isr; pins[pin].isrArg = nullptr; pins[pin].edge = mode;
+}
+void attachInterruptArg(uint8_t pin, void (*isr)(void*), void* arg, int mode) {
+    if (pin >= HAL_PINS) return;
+    pins[pin].isr = nullptr; pins[pin].isrArg = isr; pins[pin].arg = arg; pins[pin].edge = mode;
+}
+void detachInterrupt(uint8_t pin) {
+    if (pin >= HAL_PINS) return;
+    pins[pin].isr = nullptr; pins[pin].isrArg = nullptr; pins[pin].edge = 0;
+}
+
+size_t HardwareSerial::print(const char* t) {
+    if (!serialMuted) fputs(t, stdout);
+    return strlen(t);
+}
+size_t HardwareSerial::print(long v, int base) {
+    char b[40];
+    if (base == 16) snprintf(b, sizeof(b), "%lx", v); else snprintf(b, sizeof(b), "%ld", v);
+    return print(b);
+}
+size_t HardwareSerial::print(unsigned long v, int base) {
+    char b[40];
+    if (base == 16) snprintf(b, sizeof(b), "%lx", v); else snprintf(b, sizeof(b), "%lu", v);
+    return print(b);
+}
+size_t HardwareSerial::print(double v, int digits) {
+    char b[48];
+    snprintf(b, sizeof(b), "%.*f", digits, v);
+    return print(b);
+}
+int HardwareSerial::available() { return (int)serialIn.size(); }
+int HardwareSerial::read() {
+    if (serialIn.empty()) return -1;
+    int c = (unsigned char)serialIn[0];
+    serialIn.erase(0, 1);
+    return c;
+}
+String HardwareSerial::readStringUntil(char end) {
+    size_t p = serialIn.find(end);
+    std::string line = serialIn.substr(0, p);
+    serialIn.erase(0, p == std::string::npos ? std::string::npos : p + 1);
+    return String(line);
+}
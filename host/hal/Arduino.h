@@ -0,0 +1,144 @@
+// Host stand-in for the parts of the Arduino-ESP32 core the sketches use.
+// Time is virtual: nothing sleeps, delay() and friends move the clock
+// forward and fire any scripted pin changes (and their ISRs) on the way.
+// Test programs drive the world through the hal_* functions: plant models
+// registered with hal_addModel() are stepped on their period as the clock
+// moves, and hal_watchOutput() lets them see what the sketch writes.
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <cstdio>
+#include <string>
+#include <algorithm>
+
+#define HIGH            1
+#define LOW             0
+#define INPUT           0
+#define OUTPUT          1
+#define INPUT_PULLUP    2
+#define RISING          1
+#define FALLING         2
+#define CHANGE          3
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+#define F(s)            (s)
+#define PROGMEM
+typedef char __FlashStringHelper;
+
+using std::min;
+using std::max;
+
+// ---- virtual time / world (host only) ----
+#define HAL_PINS 40
+uint64_t hal_nowUs();
+void hal_advanceTo(uint64_t us, volatile bool* stopWhenSet = nullptr);
+void hal_setPin(uint8_t pin, int level);                   // input changes now (fires its ISR)
+void hal_schedulePin(uint64_t atUs, uint8_t pin, int level);
+void hal_setAnalog(uint8_t pin, int value);
+int  hal_output(uint8_t pin);                               // last digitalWrite/analogWrite
+int  hal_duty(uint8_t pin);                                 // same as 0..255 (digital HIGH = 255)
+void hal_watchOutput(uint8_t pin, void (*fn)(uint8_t pin, int value, void* arg), void* arg);
+void hal_addModel(uint32_t periodUs, void (*fn)(uint64_t nowUs, void* arg), void* arg);
+void hal_serialMute(bool mute);
+void hal_serialFeed(const char* text);
+
+// ---- core API ----
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int  digitalRead(uint8_t pin);
+int  analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+unsigned long pulseIn(uint8_t pin, uint8_t state, unsigned long timeoutUs = 1000000UL);
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void attachInterruptArg(uint8_t pin, void (*isr)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+inline void noInterrupts() {}
+inline void interrupts() {}
+// ISRs only run inside hal_* calls here, never in the middle of sketch code,
+// so the FreeRTOS spinlock sections have nothing to exclude.
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(m)           ((void)(m))
+#define portEXIT_CRITICAL(m)            ((void)(m))
+#define portENTER_CRITICAL_ISR(m)       ((void)(m))
+#define portEXIT_CRITICAL_ISR(m)        ((void)(m))
+
+template <class T, class L, class H>
+inline T constrain(T x, L lo, H hi) { return x < lo ? lo : (x > hi ? hi : x); }
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+class String {
+    public:
+        std::string s;
+        String() {}
+        String(const char* c) : s(c ? c : "") {}
+        String(const std::string& x) : s(x) {}
+        String(char c) : s(1, c) {}
+        String(int v) : s(std::to_string(v)) {}
+        String(unsigned v) : s(std::to_string(v)) {}
+        String(long v) : s(std::to_string(v)) {}
+        String(unsigned long v) : s(std::to_string(v)) {}
+        String(double v, int d = 2) { char b[32]; snprintf(b, sizeof(b), "%.*f", d, v); s = b; }
+
+        String& operator+=(const String& o) { s += o.s; return *this; }
+        String& operator+=(const char* o) { s += o; return *this; }
+        String& operator+=(char c) { s += c; return *this; }
+        String& operator+=(int v) { s += std::to_string(v); return *this; }
+        String& operator+=(unsigned v) { s += std::to_string(v); return *this; }
+        String& operator+=(long v) { s += std::to_string(v); return *this; }
+        String& operator+=(unsigned long v) { s += std::to_string(v); return *this; }
+        String& operator+=(double v) { return *this += String(v); }
+        bool operator==(const char* o) const { return s == o; }
+        bool operator==(const String& o) const { return s == o.s; }
+        bool operator!=(const char* o) const { return s != o; }
+
+        void trim() {
+            size_t a = s.find_first_not_of(" \t\r\n"), b = s.find_last_not_of(" \t\r\n");
+            s = a == std::string::npos ? "" : s.substr(a, b - a + 1);
+        }
+        void toLowerCase() { for (char& c : s) c = (char)tolower((unsigned char)c); }
+        int indexOf(char c) const { size_t p = s.find(c); return p == std::string::npos ? -1 : (int)p; }
+        int indexOf(const char* t) const { size_t p = s.find(t); return p == std::string::npos ? -1 : (int)p; }
+        bool startsWith(const char* t) const { return s.compare(0, strlen(t), t) == 0; }
+        String substring(int a, int b = -1) const { return b < 0 ? String(s.substr(a)) : String(s.substr(a, b - a)); }
+        long toInt() const { return atol(s.c_str()); }
+        float toFloat() const { return (float)atof(s.c_str()); }
+        const char* c_str() const { return s.c_str(); }
+        unsigned length() const { return (unsigned)s.size(); }
+        char operator[](unsigned i) const { return s[i]; }
+};
+inline String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+inline String operator+(const char* a, const String& b) { return String(a + b.s); }
+inline String operator+(const String& a, const char* b) { return String(a.s + b); }
+
+class HardwareSerial {
+    public:
+        void begin(unsigned long) {}
+        size_t print(const char* t);
+        size_t print(const String& t) { return print(t.c_str()); }
+        size_t print(char c) { char b[2] = { c, 0 }; return print(b); }
+        size_t print(long v, int base = 10);
+        size_t print(unsigned long v, int base = 10);
+        size_t print(int v, int base = 10) { return print((long)v, base); }
+        size_t print(unsigned v, int base = 10) { return print((unsigned long)v, base); }
+        size_t print(double v, int digits = 2);
+        template <class T> size_t println(const T& v) { size_t n = print(v); return n + print("\n"); }
+        template <class T> size_t println(const T& v, int f) { size_t n = print(v, f); return n + print("\n"); }
+        size_t println() { return print("\n"); }
+        int available();
+        int read();
+        String readStringUntil(char end);
+};
+extern HardwareSerial Serial;
@@ -0,0 +1,27 @@
+// Host stand-in for the ESP32 EEPROM library: a RAM buffer, so a
+// configuration saved during a run loads back in the same run.
+#pragma once
+#include "Arduino.h"
+
+class EEPROMClass {
+    public:
+        bool begin(size_t size) { if (size > sizeof(mem)) return false; len = size; return true; }
+        uint8_t read(int addr) const { return inRange(addr, 1) ? mem[addr] : 0xFF; }
+        void write(int addr, uint8_t v) { if (inRange(addr, 1)) mem[addr] = v; }
+        template <class T> T& get(int addr, T& t) const {
+            if (inRange(addr, sizeof(T))) memcpy((void*)&t, mem + addr, sizeof(T));
+            return t;
+        }
+        template <class T> const T& put(int addr, const T& t) {
+            if (inRange(addr, sizeof(T))) memcpy(mem + addr, (const void*)&t, sizeof(T));
+            return t;
+        }
+        bool commit() { return len != 0; }
+        size_t length() const { return len; }
+    private:
+        uint8_t mem[4096] = {};
+        size_t len = 0;
+        bool inRange(int addr, size_t n) const { return addr >= 0 && (size_t)addr + n <= len; }
+};
+
+inline EEPROMClass EEPROM;
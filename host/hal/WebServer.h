@@ -0,0 +1,101 @@
+// Host stand-in for the ESP32 WebServer. No sockets: a test queues a request
+// with inject("/path?a=1"), optionally with headers, and the next
+// handleClient() runs its handler, exactly as loop() would on the board. The reply is kept in lastCode /
+// lastType / lastBody, and its extra headers through lastHeader().
+#pragma once
+#include <deque>
+#include <vector>
+#include "Arduino.h"
+
+class WebServer {
+    public:
+        typedef void (*Handler)();
+
+        explicit WebServer(int port = 80) { (void)port; }
+        void begin() {}
+        void on(const char* uri, Handler fn) { routes.push_back(Route{ uri, fn }); }
+        void onNotFound(Handler fn) { notFound = fn; }
+
+        void handleClient() {
+            if (pending.empty()) return;
+            std::string req = pending.front().line;
+            requestHeaders = pending.front().headers;
+            pending.pop_front();
+            size_t q = req.find('?');
+            path = req.substr(0, q);
+            query = q == std::string::npos ? "" : req.substr(q + 1);
+            served++;
+            for (const Route& r : routes) if (r.uri == path) { r.fn(); return; }
+            if (notFound) notFound(); else send(404, "text/plain", "Not found");
+        }
+
+        void send(int code) { send_P(code, "", "", 0); }
+        void send(int code, const char* type, const String& body) { send_P(code, type, body.c_str(), body.length()); }
+        void send(int code, const char* type, const char* body) { send_P(code, type, body, strlen(body)); }
+        // On the board: body streamed from flash. Here flash is just memory.
+        void send_P(int code, const char* type, const char* body, size_t length) {
+            lastCode = code;
+            lastType = type;
+            lastBody.assign(body, length);
+            lastHeaders.swap(headers);
+            headers.clear();
+        }
+        // Extra header for the next send()
+        void sendHeader(const String& name, const String& value, bool first = false) {
+            (void)first;
+            headers.push_back(Header{ name.s, value.s });
+        }
+        // Value of a header on the last reply, "" if it had none
+        std::string lastHeader(const char* name) const {
+            for (const Header& h : lastHeaders) if (h.name == name) return h.value;
+            return std::string();
+        }
+
+        bool hasArg(const char* name) const { return find(name) != std::string::npos; }
+        String arg(const char* name) const {
+            size_t p = find(name);
+            if (p == std::string::npos) return String();
+            p += strlen(name) + 1;
+            return String(query.substr(p, query.find('&', p) - p));
+        }
+        String uri() const { return String(path); }
+
+        // Like the board, only headers named here are kept from a request
+        void collectHeaders(const char* keys[], size_t count) { collected.assign(keys, keys + count); }
+        String header(const char* name) const {
+            for (const std::string& k : collected) {
+                if (k != name) continue;
+                for (const Header& h : requestHeaders) if (h.name == name) return String(h.value);
+            }
+            return String();
+        }
+
+        // Host only
+        void inject(const char* request, std::vector<std::pair<std::string, std::string>> headers = {}) {
+            Request r{ request, {} };
+            for (auto& h : headers) r.headers.push_back(Header{ h.first, h.second });
+            pending.push_back(r);
+        }
+        uint32_t served = 0;
+        int lastCode = 0;
+        std::string lastType, lastBody;
+
+    private:
+        struct Route { std::string uri; Handler fn; };
+        struct Header { std::string name, value; };
+        struct Request { std::string line; std::vector<Header> headers; };
+        std::vector<Header> headers, lastHeaders, requestHeaders;
+        std::vector<std::string> collected;
+        std::vector<Route> routes;
+        std::deque<Request> pending;
+        Handler notFound = nullptr;
+        std::string path, query;
+
+        size_t find(const char* name) const {
+            std::string key = std::string(name) + "=";
+            for (size_t p = 0; (p = query.find(key, p)) != std::string::npos; p++) {
+                if (p == 0 || query[p - 1] == '&') return p;
+            }
+            return std::string::npos;
+        }
+};
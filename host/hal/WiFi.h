@@ -0,0 +1,23 @@
+// Host stand-in for the ESP32 WiFi library. There is no radio; the access
+// point calls succeed and report the configured address.
+#pragma once
+#include "Arduino.h"
+
+class IPAddress {
+    public:
+        IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : o{ a, b, c, d } {}
+        uint8_t operator[](int i) const { return o[i]; }
+    private:
+        uint8_t o[4];
+};
+
+class WiFiClass {
+    public:
+        bool softAP(const char*, const char* = nullptr) { return true; }
+        bool softAPConfig(IPAddress ip, IPAddress, IPAddress) { addr = ip; return true; }
+        IPAddress softAPIP() const { return addr; }
+    private:
+        IPAddress addr = IPAddress(192, 168, 4, 1);
+};
+
+inline WiFiClass WiFi;
@@ -0,0 +1,3 @@
+// Host stand-in: the GPIO API is in Arduino.h
+#pragma once
+#include "Arduino.h"
@@ -0,0 +1,3 @@
+// Host stand-in: no IRAM on the host, see Arduino.h
+#pragma once
+#include "Arduino.h"
@@ -0,0 +1,321 @@
+// Load test for the web server task (MidSem/Project/HttpTask.h) on POSIX
+// sockets. The task runs on its own thread exactly as on the board; main()
+// plays loop(): it drains webCommands, answers /metrics, changes the bridge
+// state every STATE_EVERY_MS and publishes controlStates the way
+// webPage_publish() does, timing that queue work on every pass.
+//
+// Against it, on localhost:
+//   clients   request in a loop: /state, the page, the page with its ETag
+//             (a 304), /metrics (a round trip through loop()) and /switchState
+//   slow      send half a request and stall, holding a connection slot
+//             until the server times them out (408)
+//   streams   two /events readers, timing each state change from loop()
+//             publishing it to the message arriving
+// Then loop()'s queue work per pass is compared with an idle second before
+// the clients started: it should not move, since nothing in loop() waits on
+// a socket.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -pthread -Ihal -I../MidSem/Project http_load.cpp ../MidSem/Project/HttpTask.cpp ../MidSem/Project/HttpSite.cpp ../MidSem/Project/LoopStats.cpp hal/Arduino.cpp -o http_load
+//   ./http_load [seconds] [clients] [slow clients]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <signal.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "HttpTask.h"
+#include "WebPageHtml.h"
+
+#define HTTP_LOAD_PORT      18080
+#define PASS_US             200     // loop() pass period
+#define STATE_EVERY_MS      250
+#define STREAMS             2
+#define PUBLISH_MS          50      // as WebPage_PublishMs
+
+typedef std::chrono::steady_clock Clock;
+
+static int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+}
+
+static std::atomic<bool> running(true);
+static std::atomic<int> publishedState(0);
+static std::atomic<int64_t> publishedAtUs(0);
+static std::atomic<uint32_t> commandsSeen(0);
+static std::atomic<uint32_t> metricsAnswered(0);
+
+// ---- loop() stand-in ----
+
+struct PassStats {
+    uint32_t passes = 0;
+    int64_t maxUs = 0;
+    int64_t sumUs = 0;
+    void add(int64_t us) { passes++; sumUs += us; if (us > maxUs) maxUs = us; }
+};
+
+static const char* const stateNames[] = { "", "Lowered", "Prep Raise", "Raising", "Raised", "Prep Lower", "Lowering" };
+
+static void controller(PassStats* idle, PassStats* loaded, std::atomic<bool>* underLoad) {
+    ControlState s = ControlState();
+    s.state = lowered;
+    s.nextState = stateNames[lowered];
+    ControlState last = ControlState();
+    bool published = false;
+    int64_t lastPublishUs = 0, lastChangeUs = nowUs();
+    uint32_t pass = 0;
+    static WebReply reply;      // stats left at zero: virtual time doesn't move here
+    while (running.load()) {
+        int64_t t0 = nowUs();
+
+        WebCommand cmd;
+        while (webCommands.pop(cmd)) {
+            commandsSeen++;
+            if (cmd.type == Web_Metrics) {
+                reply.ticket = cmd.ticket;
+                if (webReplies.push(reply)) metricsAnswered++;
+            }
+        }
+        if (t0 - lastChangeUs >= STATE_EVERY_MS * 1000) {
+            s.state = (bridgeState)(s.state % lowering + 1);
+            s.nextState = stateNames[s.state];
+            s.trafficLight = s.state % 3;
+            lastChangeUs = t0;
+        }
+        s.sonic1 = DistanceMM((uint16_t)(1000 + pass % 7));
+        s.gpioElided = pass;
+        if (!published || !sameLights(s, last) || t0 - lastPublishUs >= PUBLISH_MS * 1000) {
+            if (controlStates.push(s)) {
+                if (!published || s.state != last.state) {
+                    publishedAtUs.store(nowUs());
+                    publishedState.store(s.state);
+                }
+                last = s;
+                lastPublishUs = t0;
+                published = true;
+            }
+        }
+
+        (underLoad->load() ? loaded : idle)->add(nowUs() - t0);
+        pass++;
+        std::this_thread::sleep_for(std::chrono::microseconds(PASS_US));
+    }
+}
+
+// ---- clients ----
+
+static int connectTo() {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    struct timeval tv = { 10, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    struct sockaddr_in addr = sockaddr_in();
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(HTTP_LOAD_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool sendAll(int fd, const std::string& data) {
+    return send(fd, data.data(), data.size(), MSG_NOSIGNAL) == (ssize_t)data.size();
+}
+
+// The whole response (the server closes after it), or "" on a timeout
+static std::string exchange(const std::string& request) {
+    int fd = connectTo();
+    if (fd < 0) return "";
+    std::string response;
+    if (sendAll(fd, request)) {
+        char buf[4096];
+        ssize_t n;
+        while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) response.append(buf, n);
+        if (n < 0) response.clear();
+    }
+    close(fd);
+    return response;
+}
+
+static int statusOf(const std::string& response) {
+    return response.compare(0, 9, "HTTP/1.1 ") == 0 ? atoi(response.c_str() + 9) : 0;
+}
+
+struct Route {
+    const char* name;
+    std::string request;
+    int status;
+    size_t bodyBytes;       // 0: any
+};
+
+struct Tally {
+    std::vector<std::vector<uint32_t>> latencyUs;
+    uint32_t errors = 0;
+};
+
+static void client(const std::vector<Route>* routes, Tally* tally, uint32_t seed) {
+    tally->latencyUs.resize(routes->size());
+    static const uint8_t mix[] = { 0, 0, 0, 0, 0, 1, 2, 2, 3, 4 };
+    for (uint32_t i = seed; running.load(); i++) {
+        uint8_t r = mix[i % sizeof(mix)];
+        const Route& route = (*routes)[r];
+        int64_t t0 = nowUs();
+        std::string response = exchange(route.request);
+        int64_t us = nowUs() - t0;
+        size_t bodyAt = response.find("\r\n\r\n");
+        bool ok = statusOf(response) == route.status
+               && (!route.bodyBytes || (bodyAt != std::string::npos && response.size() - bodyAt - 4 == route.bodyBytes));
+        if (!ok) {
+            if (running.load()) tally->errors++;
+            continue;
+        }
+        tally->latencyUs[r].push_back((uint32_t)us);
+    }
+}
+
+static void slowClient(std::atomic<uint32_t>* timedOut, std::atomic<uint32_t>* wrong) {
+    while (running.load()) {
+        std::string response = exchange("GET /state HTTP/1.1\r\nHost: bridge\r\n");
+        if (!running.load()) break;
+        if (statusOf(response) == 408) (*timedOut)++;
+        else (*wrong)++;
+    }
+}
+
+struct StreamTally {
+    uint32_t messages = 0;
+    std::vector<uint32_t> changeUs;     // publish to arrival, per state change
+    bool connected = false;
+};
+
+static void streamClient(StreamTally* tally) {
+    int fd = connectTo();
+    if (fd < 0) return;
+    struct timeval tv = { 0, 200000 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    if (!sendAll(fd, "GET /events HTTP/1.1\r\nHost: bridge\r\nAccept: text/event-stream\r\n\r\n")) {
+        close(fd);
+        return;
+    }
+    std::string pending;
+    int seen = -1;
+    char buf[2048];
+    while (running.load()) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n == 0) break;
+        if (n < 0) continue;
+        int64_t at = nowUs();
+        pending.append(buf, n);
+        if (!tally->connected) {
+            if (pending.compare(0, 15, "HTTP/1.1 200 OK") != 0) break;
+            tally->connected = true;
+        }
+        size_t end;
+        while ((end = pending.find("\n\n")) != std::string::npos) {
+            std::string event = pending.substr(0, end);
+            pending.erase(0, end + 2);
+            size_t p = event.find("\"bridgeState\":");
+            if (event.find("event: state") == std::string::npos || p == std::string::npos) continue;
+            tally->messages++;
+            int state = atoi(event.c_str() + p + 14);
+            if (seen >= 0 && state != seen && state == publishedState.load()) {
+                tally->changeUs.push_back((uint32_t)(at - publishedAtUs.load()));
+            }
+            seen = state;
+        }
+    }
+    close(fd);
+}
+
+// ---- report ----
+
+static uint32_t percentile(std::vector<uint32_t>& v, double p) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, (size_t)(p * v.size()))];
+}
+
+int main(int argc, char** argv) {
+    const int seconds = argc > 1 ? atoi(argv[1]) : 5;
+    const int clients = argc > 2 ? atoi(argv[2]) : 8;
+    const int slow = argc > 3 ? atoi(argv[3]) : 3;
+    signal(SIGPIPE, SIG_IGN);
+
+    if (!httpTask_init(HTTP_LOAD_PORT)) {
+        fprintf(stderr, "can't listen on port %d\n", HTTP_LOAD_PORT);
+        return 2;
+    }
+
+    PassStats idle, loaded;
+    std::atomic<bool> underLoad(false);
+    std::thread loopThread(controller, &idle, &loaded, &underLoad);
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    const std::vector<Route> routes = {
+        { "/state",           "GET /state HTTP/1.1\r\nHost: bridge\r\n\r\n", 200, 0 },
+        { "/",                "GET / HTTP/1.1\r\nHost: bridge\r\nAccept-Encoding: gzip\r\n\r\n", 200, webPage_gzLength },
+        { "/ (etag)",         std::string("GET / HTTP/1.1\r\nHost: bridge\r\nIf-None-Match: ") + webPage_gzETag + "\r\n\r\n", 304, 0 },
+        { "/metrics",         "GET /metrics HTTP/1.1\r\nHost: bridge\r\n\r\n", 200, 0 },
+        { "/switchState",     "GET /switchState HTTP/1.1\r\nHost: bridge\r\n\r\n", 200, webPage_gzLength },
+    };
+    std::vector<Tally> tallies(clients);
+    std::vector<StreamTally> streams(STREAMS);
+    std::atomic<uint32_t> timedOut(0), slowWrong(0);
+    std::vector<std::thread> threads;
+
+    underLoad.store(true);
+    int64_t start = nowUs();
+    for (int i = 0; i < STREAMS; i++) threads.emplace_back(streamClient, &streams[i]);
+    for (int i = 0; i < slow; i++) threads.emplace_back(slowClient, &timedOut, &slowWrong);
+    for (int i = 0; i < clients; i++) threads.emplace_back(client, &routes, &tallies[i], (uint32_t)i * 3);
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    running.store(false);
+    for (std::thread& t : threads) t.join();
+    loopThread.join();
+    double secs = (nowUs() - start) / 1e6;
+
+    uint32_t total = 0, errors = 0;
+    printf("%-14s %8s %8s %8s %8s\n", "route", "count", "p50 us", "p99 us", "max us");
+    for (size_t r = 0; r < routes.size(); r++) {
+        std::vector<uint32_t> all;
+        for (Tally& t : tallies) all.insert(all.end(), t.latencyUs[r].begin(), t.latencyUs[r].end());
+        total += all.size();
+        uint32_t p50 = percentile(all, 0.50), p99 = percentile(all, 0.99);
+        printf("%-14s %8zu %8u %8u %8u\n", routes[r].name, all.size(), p50, p99, all.empty() ? 0 : all.back());
+    }
+    for (Tally& t : tallies) errors += t.errors;
+    printf("requests %u (%.0f/s) from %d clients, errors %u\n", total, total / secs, clients, errors);
+    printf("commands reaching loop() %u, /metrics answered %u\n", commandsSeen.load(), metricsAnswered.load());
+    printf("slow clients %d: %u timed out with 408, %u other\n", slow, timedOut.load(), slowWrong.load());
+
+    std::vector<uint32_t> changes;
+    uint32_t messages = 0;
+    bool streamsUp = true;
+    for (StreamTally& s : streams) {
+        streamsUp = streamsUp && s.connected;
+        messages += s.messages;
+        changes.insert(changes.end(), s.changeUs.begin(), s.changeUs.end());
+    }
+    uint32_t changeP50 = percentile(changes, 0.50), changeP99 = percentile(changes, 0.99);
+    printf("streams %d: %u messages, %zu state changes, publish to arrival p50 %u us p99 %u us max %u us\n",
+           STREAMS, messages, changes.size(), changeP50, changeP99, changes.empty() ? 0 : changes.back());
+    printf("loop() queue work per pass: idle avg %.2f us max %lld us (%u passes), loaded avg %.2f us max %lld us (%u passes)\n",
+           idle.passes ? (double)idle.sumUs / idle.passes : 0.0, (long long)idle.maxUs, idle.passes,
+           loaded.passes ? (double)loaded.sumUs / loaded.passes : 0.0, (long long)loaded.maxUs, loaded.passes);
+
+    bool ok = errors == 0 && total > 0 && slowWrong.load() == 0 && (!slow || timedOut.load() > 0)
+           && streamsUp && !changes.empty();
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+// Replays an input journal from MidSem/ProjectTest (see Journal.h) through
+// the sketch's own state machine and checks it comes out the same.
+//
+// The input is either the raw journal bytes or a saved serial log with a
+// "journal" dump in it (hex between the "JOURNAL <bytes>" and "END" lines).
+// Config and key records set the configuration and where the FSM was, each
+// frame runs one stateMachine() pass at its recorded time, and after every
+// pass the lights, motor drive and state are compared with what the bridge
+// recorded. The first difference is reported and the replay stops there.
+//
+// A key at the start of the recording (state 0) replays exactly. A key in
+// the middle of a run (the older half was overwritten) restores the state by
+// entering it again, so anything the state counts internally starts over.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -pthread -Ihal -I../MidSem/ProjectTest journal_replay.cpp hal/Arduino.cpp ../MidSem/ProjectTest/*.cpp -o journal_replay
+//   ./journal_replay <journal.bin | serial.log> [-v]
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+#include "main.h"
+
+static bool verbose = false;
+
+// Pulls the hex dump out of a serial log, or returns the file as it is
+static std::vector<uint8_t> loadJournal(const std::string& text) {
+    size_t at = text.find("JOURNAL ");
+    if (at == std::string::npos) return std::vector<uint8_t>(text.begin(), text.end());
+    std::vector<uint8_t> bytes;
+    std::istringstream in(text.substr(at));
+    std::string line;
+    std::getline(in, line);
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line == "END") break;
+        for (size_t i = 0; i + 1 < line.size(); i += 2) {
+            bytes.push_back((uint8_t)std::stoul(line.substr(i, 2), nullptr, 16));
+        }
+    }
+    return bytes;
+}
+
+class Reader {
+    public:
+        Reader(const std::vector<uint8_t>& b) : bytes(b) {}
+        bool more() const { return pos < bytes.size(); }
+        bool has(size_t n) const { return pos + n <= bytes.size(); }
+        uint8_t peek() const { return bytes[pos]; }
+        size_t offset() const { return pos; }
+        uint8_t u8() { return bytes[pos++]; }
+        uint16_t u16() { uint16_t v = u8(); return v | (uint16_t)u8() << 8; }
+        uint32_t u32() { uint32_t v = u16(); return v | (uint32_t)u16() << 16; }
+        uint32_t var() {
+            uint32_t v = 0;
+            for (int shift = 0; more() && shift < 35; shift += 7) {
+                uint8_t b = u8();
+                v |= (uint32_t)(b & 0x7F) << shift;
+                if (!(b & 0x80)) break;
+            }
+            return v;
+        }
+    private:
+        const std::vector<uint8_t>& bytes;
+        size_t pos = 0;
+};
+
+static JournalOut snapshot() {
+    uint8_t lights = (outputs.get(Pin_TrafficRed) ? 1 : 0) | (outputs.get(Pin_TrafficYellow) ? 2 : 0)
+                   | (outputs.get(Pin_TrafficGreen) ? 4 : 0);
+    return JournalOut{ currentState, lights, motor.drive() };
+}
+
+static void printOut(const char* label, const JournalOut& o) {
+    printf("  %-9s %-15s lights %c%c%c  drive %3u\n", label, getStateName((bridgeState)o.state),
+           o.lights & 1 ? 'R' : '-', o.lights & 2 ? 'Y' : '-', o.lights & 4 ? 'G' : '-', o.drive);
+}
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-v")) verbose = true;
+        else path = argv[i];
+    }
+    if (!path) {
+        fprintf(stderr, "usage: %s <journal.bin | serial.log> [-v]\n", argv[0]);
+        return 2;
+    }
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return 2;
+    }
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::vector<uint8_t> bytes = loadJournal(text);
+    hal_serialMute(true);
+    motor.init();       // disable() reads the direction pin back, so it must be an output
+
+    Reader r(bytes);
+    // Skip to the first key; a dump can start part way into a half
+    while (r.more() && r.peek() != J_Config) r.u8();
+
+    uint32_t nowMs = 0;
+    uint32_t passes = 0, checked = 0;
+    SensorFrame frame = SensorFrame();
+    JournalOut recorded = JournalOut{ 0, 0xFF, 0 };
+    bridgeState shown = (bridgeState)0;
+    bool keyed = false;
+
+    while (r.more()) {
+        size_t at = r.offset();
+        uint8_t tag = r.u8();
+        switch (tag) {
+            case J_Config: {
+                if (!r.has(sizeof(BridgeConfig))) goto truncated;
+                BridgeConfig c;
+                uint8_t* p = (uint8_t*)&c;
+                for (size_t i = 0; i < sizeof(BridgeConfig); i++) p[i] = r.u8();
+                bridgeConfig.setConfig(c);
+                if (verbose) printf("%9.3f s  config\n", nowMs / 1e3);
+                break;
+            }
+            case J_Key: {
+                if (!r.has(10)) goto truncated;
+                uint8_t version = r.u8();
+                if (version != Journal_Version) {
+                    fprintf(stderr, "journal version %u, this replayer reads %u\n", version, Journal_Version);
+                    return 2;
+                }
+                uint32_t t = r.u32();
+                uint8_t state = r.u8();
+                uint32_t inState = r.u32();
+                nowMs = t;
+                if (!keyed) {
+                    hal_advanceTo((uint64_t)nowMs * 1000);
+                    if (state) stateMachineRestore((bridgeState)state, t - inState);
+                    keyed = true;
+                    printf("%9.3f s  start in %s (%lu ms in)\n", t / 1e3,
+                           state ? getStateName((bridgeState)state) : "power-up", (unsigned long)inState);
+                }
+                recorded = JournalOut{ 0, 0xFF, 0 };
+                break;
+            }
+            case J_Set:
+                if (!r.has(1)) goto truncated;
+                currentState = (bridgeState)r.u8();
+                if (verbose) printf("%9.3f s  forced %s\n", nowMs / 1e3, getStateName(currentState));
+                break;
+            case J_Frame:
+            case J_Same: {
+                nowMs += r.var();
+                if (tag == J_Frame) {
+                    if (!r.has(4)) goto truncated;
+                    frame.sonic = DistanceMM(r.u16());
+                    frame.sonicConfidence = r.u8();
+                    uint8_t flags = r.u8();
+                    frame.eStop = flags & J_EStop;
+                    frame.topLimit = flags & J_Top;
+                    frame.bottomLimit = flags & J_Bottom;
+                    if (verbose) {
+                        printf("%9.3f s  sonic %4u mm (%3u%%)%s%s%s\n", nowMs / 1e3, frame.sonic.mm(),
+                               frame.sonicConfidence, frame.eStop ? " ESTOP" : "",
+                               frame.topLimit ? " TOP" : "", frame.bottomLimit ? " BOTTOM" : "");
+                    }
+                }
+                frame.timeMs = nowMs;
+                hal_advanceTo((uint64_t)nowMs * 1000);
+                stateMachine(frame);
+                passes++;
+
+                if (r.more() && r.peek() == J_Out) {
+                    if (!r.has(4)) goto truncated;
+                    r.u8();
+                    recorded.state = r.u8();
+                    recorded.lights = r.u8();
+                    recorded.drive = r.u8();
+                }
+                JournalOut replayed = snapshot();
+                if (recorded.lights == 0xFF) break;     // nothing recorded yet
+                checked++;
+                if (replayed != recorded) {
+                    printf("%9.3f s  DIVERGED after pass %lu (journal offset %lu)\n",
+                           nowMs / 1e3, (unsigned long)passes, (unsigned long)at);
+                    printOut("bridge", recorded);
+                    printOut("replay", replayed);
+                    return 1;
+                }
+                if (currentState != shown) {
+                    printf("%9.3f s  %-15s sonic %4u mm  drive %3u\n", nowMs / 1e3,
+                           getStateName(currentState), frame.sonic.mm(), replayed.drive);
+                    shown = currentState;
+                }
+                break;
+            }
+            case J_Out:
+                // Only valid straight after a pass, where it is consumed above
+                fprintf(stderr, "stray output record at offset %lu\n", (unsigned long)at);
+                return 2;
+            default:
+                fprintf(stderr, "bad record 0x%02x at offset %lu\n", tag, (unsigned long)at);
+                return 2;
+        }
+    }
+    printf("%lu bytes, %lu passes, %lu checked: replay matches\n",
+           (unsigned long)bytes.size(), (unsigned long)passes, (unsigned long)checked);
+    return 0;
+
+truncated:
+    fprintf(stderr, "journal truncated at offset %lu\n", (unsigned long)r.offset());
+    return 2;
+}
@@ -0,0 +1,119 @@
+// Virtual-time benchmark for the ProjectTest run loop (MidSem/ProjectTest/RunLoop.h).
+// Runs the same job mix as ProjectTest - web/serial poll every 50ms, sonic
+// ping every 60ms, sensor log every second, state pass on edges and pings - against
+// a scripted limit switch, once on the tickless run loop and once as the old
+// "do everything, delay(50)" loop. Work is charged as virtual CPU time, so
+// the numbers are about scheduling, not this machine.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -Ihal -I../MidSem/ProjectTest runloop_bench.cpp hal/Arduino.cpp ../MidSem/ProjectTest/RunLoop.cpp -o runloop_bench
+//   ./runloop_bench [seconds]
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "Arduino.h"
+#include "RunLoop.h"
+
+#define PIN_LIMIT       16
+#define COST_IO_US      50      // handleClient() with no client + Serial.available()
+#define COST_SONIC_US   20
+#define COST_LOG_US     200
+#define COST_PASS_US    30      // captureSensors() + one state machine pass
+
+struct Result {
+    uint32_t passes = 0;
+    uint64_t busyUs = 0;
+    uint32_t reactions = 0;
+    uint64_t reactSumUs = 0;
+    uint64_t reactMaxUs = 0;
+};
+
+static Result res;
+static std::vector<uint64_t> edges;     // scripted edge times, in order
+static size_t nextEdge = 0;
+static int seenLevel = LOW;
+
+static void work(uint32_t us) { res.busyUs += us; delayMicroseconds(us); }
+
+static void ioJob(uint32_t)    { work(COST_IO_US); }
+static void sonicJob(uint32_t) { work(COST_SONIC_US); }
+static void logJob(uint32_t)   { work(COST_LOG_US); }
+
+// The state pass: notices the limit switch and "stops the motor".
+static void statePass(uint32_t) {
+    res.passes++;
+    int level = digitalRead(PIN_LIMIT);
+    if (level != seenLevel) {
+        seenLevel = level;
+        while (nextEdge + 1 < edges.size() && edges[nextEdge + 1] <= hal_nowUs()) nextEdge++;
+        uint64_t lat = hal_nowUs() - edges[nextEdge];
+        res.reactions++;
+        res.reactSumUs += lat;
+        if (lat > res.reactMaxUs) res.reactMaxUs = lat;
+        nextEdge++;
+    }
+    work(COST_PASS_US);
+}
+
+static uint32_t noDeadline(uint32_t) { return UINT32_MAX; }
+
+// Edges 150..1150ms apart, so no two land between the same pair of passes.
+static void scriptEdges(uint64_t startUs, uint64_t endUs) {
+    uint32_t rng = 12345;
+    int level = digitalRead(PIN_LIMIT);
+    edges.clear();
+    nextEdge = 0;
+    seenLevel = level;
+    for (uint64_t t = startUs + 100000; t < endUs; ) {
+        rng = rng * 1664525u + 1013904223u;
+        level = !level;
+        hal_schedulePin(t, PIN_LIMIT, level);
+        edges.push_back(t);
+        t += 150000 + (rng >> 8) % 1000000;
+    }
+}
+
+static void report(const char* name, uint64_t spanUs) {
+    double s = spanUs / 1e6;
+    printf("%-10s passes/s %7.1f  busy %5.2f%%  reactions %4u  avg %7.1f us  max %7llu us\n",
+           name, res.passes / s, 100.0 * res.busyUs / spanUs, res.reactions,
+           res.reactions ? (double)res.reactSumUs / res.reactions : 0.0,
+           (unsigned long long)res.reactMaxUs);
+}
+
+int main(int argc, char** argv) {
+    uint64_t spanUs = (argc > 1 ? strtoull(argv[1], nullptr, 10) : 600) * 1000000ULL;
+    hal_serialMute(true);
+
+    // Old loop: everything every pass, then delay(50)
+    uint64_t t0 = hal_nowUs();
+    scriptEdges(t0, t0 + spanUs);
+    res = Result();
+    while (hal_nowUs() - t0 < spanUs) {
+        ioJob(0);
+        sonicJob(0);
+        statePass(0);
+        if (millis() % 1000 < 50) logJob(0);
+        delay(50);
+    }
+    report("delay(50)", hal_nowUs() - t0);
+
+    // Tickless run loop
+    runLoop.watch(PIN_LIMIT);
+    runLoop.every(50, ioJob);
+    runLoop.every(60, sonicJob, true);
+    runLoop.every(1000, logJob);
+    runLoop.onPass(statePass, noDeadline);
+    runLoop.begin();
+    t0 = hal_nowUs();
+    scriptEdges(t0, t0 + spanUs);
+    res = Result();
+    while (hal_nowUs() - t0 < spanUs) runLoop.runOnce();
+    report("tickless", hal_nowUs() - t0);
+
+    const RunLoopStats& st = runLoop.getStats();
+    printf("run loop: %.1f wakes/s (%u on edges), edge->pass max %u us\n",
+           st.wakes / (spanUs / 1e6), st.eventWakes, st.maxWakeUs);
+    return res.reactions == edges.size() ? 0 : 1;
+}
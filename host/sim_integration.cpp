@@ -0,0 +1,92 @@
+// Virtual-time simulation of the Integration sketch against the bridge plant
+// and boat traffic. setup() and loop() are the sketch's own (Integration.ino
+// is compiled as C++), the FSM is BridgeCore<SimHw>, and the limit switches
+// and sonar echoes arrive through the host HAL's pins and ISRs.
+//
+// Layout (x along the channel, mm): the span runs from 0 to 300 with
+// SonarUnder looking across the channel at its far end (300), so "not under"
+// means the hull is clear of the span. SonarWait is SONAR_SPACING_MM (600)
+// before it at -300, looking down-channel. Boats hold at the waiting line
+// (-650, 350mm short of SonarWait) until the span is open.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -pthread -Ihal -I../Integration sim_integration.cpp hal/Arduino.cpp ../Integration/main.cpp ../Integration/InputEvents.cpp ../Integration/EchoCapture.cpp ../Integration/Webpage.cpp ../Integration/HttpTask.cpp ../Integration/HttpSite.cpp -x c++ ../Integration/Integration.ino -o sim_integration
+//   ./sim_integration [boats] [-v]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "Arduino.h"
+#include "Config.h"
+#include "Hardware.h"
+#include "BridgeCore.h"
+#include "BridgePlant.h"
+#include "BoatEcho.h"
+
+void setup();
+void loop();
+
+#define LOOP_US         500     // virtual CPU time per loop() pass
+#define BOAT_GAP_MS     45000   // between boats entering the model
+#define OPEN_FRACTION   0.95f   // span this far up counts as open
+
+static int motorDrive() {
+    const SimIo& io = SimHw::io();
+    return io.dirUp ? io.duty : -io.duty;
+}
+
+static BridgePlant plant(PlantConfig(), LimitWiring{ PIN_LIM_TOP, PIN_LIM_BOT, LOW }, motorDrive);
+static bool spanOpen() { return plant.openFraction() >= OPEN_FRACTION; }
+static BoatEcho boats(0, 300, spanOpen);
+
+static const char* stateName(State s) {
+    static const char* names[] = { "DOWN", "PREP_RAISE", "RAISING", "UP", "PREP_LOW", "LOWERING", "EMERG_RAISE", "EMERG_LOWER" };
+    return s <= EMERG_LOWER ? names[s] : "?";
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 && argv[1][0] != '-' ? atoi(argv[1]) : 3;
+    bool verbose = argc > 1 && !strcmp(argv[argc - 1], "-v");
+    hal_serialMute(!verbose);
+
+    hal_setPin(PIN_ESTOP, HIGH);        // not pressed (active low)
+    for (uint8_t p : { PIN_BTN_RAISE, PIN_BTN_LOWER, PIN_BTN_ABORT }) hal_setPin(p, HIGH);
+    plant.attach();
+
+    boats.addSonar(SonarSpec{ PIN_TRIG_WAIT,  PIN_ECHO_WAIT,  -300, false, 200, 0 });
+    boats.addSonar(SonarSpec{ PIN_TRIG_UNDER, PIN_ECHO_UNDER,  300, true,  200, 1500 });
+    for (int i = 0; i < count; i++) {
+        boats.addBoat(Boat{ -3200.0f - 250.0f * BOAT_GAP_MS / 1000.0f * i, 500, 250, -650 });
+    }
+    boats.attach();
+
+    setup();
+
+    auto wall0 = std::chrono::steady_clock::now();
+    uint64_t passes = 0;
+    State last = (State)0xFF;
+    auto pass = [&]() {
+        loop();
+        passes++;
+        State s = BridgeCore<BridgeHw>::state();
+        if (s != last) {
+            printf("%9.3f s  %-11s  span %5.1f mm  motor %4d\n",
+                   hal_nowUs() / 1e6, stateName(s), plant.positionMm(), motorDrive());
+            last = s;
+        }
+        hal_advanceTo(hal_nowUs() + LOOP_US);
+    };
+    uint64_t endUs = hal_nowUs() + (uint64_t)(count + 1) * BOAT_GAP_MS * 1000ULL;
+    while (hal_nowUs() < endUs && boats.passed() < (uint32_t)count) pass();
+    // then let the span come back down after the last boat
+    for (uint64_t until = hal_nowUs() + 20000000ULL; hal_nowUs() < until && last != DOWN; ) pass();
+    double wallS = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall0).count();
+    double simS = hal_nowUs() / 1e6;
+
+    printf("boats %u/%d through, strikes %u, lifts %u, end-stop stall %.1f ms, pings %u\n",
+           boats.passed(), count, boats.strikes(), plant.fullLifts(), plant.stallUs() / 1e3, boats.pings());
+    printf("%.1f s simulated in %.3f s (%.0fx real time), %llu loop passes\n",
+           simS, wallS, simS / wallS, (unsigned long long)passes);
+    return boats.strikes() == 0 && boats.passed() == (uint32_t)count ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+// Virtual-time simulation of MidSem/ProjectTest against the bridge plant and
+// boat traffic. setup() and loop() are the sketch's own: the tickless run
+// loop sleeps in the HAL, and the plant and boats are stepped while it does,
+// so limit-switch edges and echoes wake it exactly as on the board.
+//
+// The motor driver is modelled as direction + PWM: Pin_DIR2 selects the
+// direction (HIGH = motorDirection 1 = raising by default) and the duty on
+// Pin_DIR1 is the speed, so zero duty is stopped (see Motor::disable()).
+//
+// Layout (x along the channel, mm): span from 0 to 300, the boat sensor at 0
+// looking down-channel, the far bank 3m away when no boat is in view. Boats
+// hold at -300 until the span is open.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -pthread -Ihal -I../MidSem/ProjectTest sim_projecttest.cpp hal/Arduino.cpp ../MidSem/ProjectTest/*.cpp -o sim_projecttest
+//   ./sim_projecttest [boats] [-v] [-w wall_mm] [-j journal.bin]
+//
+// -w moves the far bank; -w 0 is open water, where every ping with no boat in
+// view comes back with no echo. Run it both ways. It fails unless every boat
+// got through without a strike, the motor never drove the span into an end
+// stop, and the span is back down at the end.
+// -j saves the sketch's input journal at the end, for host/journal_replay.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "Arduino.h"
+#include "main.h"
+#include "BridgePlant.h"
+#include "BoatEcho.h"
+
+#define BOAT_GAP_MS     45000   // between boats entering the model
+#define OPEN_FRACTION   0.95f   // span this far up counts as open
+
+void setup();
+void loop();
+
+static int motorDrive() {
+    int duty = hal_duty(Pin_DIR1);
+    return hal_output(Pin_DIR2) == bridgeConfig.getMotorDirection1() ? duty : -duty;
+}
+
+static BridgePlant plant(PlantConfig(), LimitWiring{ Pin_LS_1, Pin_LS_2, HIGH }, motorDrive);
+static bool spanOpen() { return plant.openFraction() >= OPEN_FRACTION; }
+static BoatEcho boats(0, 300, spanOpen);
+
+int main(int argc, char** argv) {
+    int count = 3;
+    float wallMm = 3000;
+    bool verbose = false;
+    const char* journalPath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-v")) verbose = true;
+        else if (!strcmp(argv[i], "-j") && i + 1 < argc) journalPath = argv[++i];
+        else if (!strcmp(argv[i], "-w") && i + 1 < argc) wallMm = atof(argv[++i]);
+        else count = atoi(argv[i]);
+    }
+    hal_serialMute(!verbose);
+
+    hal_setPin(Pin_EStop, LOW);         // not pressed
+    plant.attach();
+    boats.addSonar(SonarSpec{ Pin_SonicTrigger_1, Pin_SonicEcho_1, 0, false, 200, wallMm });
+    for (int i = 0; i < count; i++) {
+        boats.addBoat(Boat{ -3000.0f - 250.0f * BOAT_GAP_MS / 1000.0f * i, 500, 250, -300 });
+    }
+    boats.attach();
+
+    setup();
+
+    auto wall0 = std::chrono::steady_clock::now();
+    uint64_t passes = 0;
+    bridgeState last = (bridgeState)0;
+    auto pass = [&]() {
+        loop();
+        passes++;
+        if (currentState != last) {
+            printf("%9.3f s  %-15s  span %5.1f mm  motor %4d\n",
+                   hal_nowUs() / 1e6, getStateName(currentState), plant.positionMm(), motorDrive());
+            last = currentState;
+        }
+    };
+    uint64_t endUs = hal_nowUs() + (uint64_t)(count + 1) * BOAT_GAP_MS * 1000ULL;
+    while (hal_nowUs() < endUs && boats.passed() < (uint32_t)count) pass();
+    // then let the span come back down after the last boat
+    for (uint64_t until = hal_nowUs() + 30000000ULL; hal_nowUs() < until && last != lowered; ) pass();
+    double wallS = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall0).count();
+    double simS = hal_nowUs() / 1e6;
+
+    printf("boats %u/%d through, strikes %u, lifts %u, end-stop stall %.1f ms, pings %u, ends %s\n",
+           boats.passed(), count, boats.strikes(), plant.fullLifts(), plant.stallUs() / 1e3, boats.pings(),
+           getStateName(last));
+    printf("%.1f s simulated in %.3f s (%.0fx real time), %llu loop passes\n",
+           simS, wallS, simS / wallS, (unsigned long long)passes);
+    if (journalPath) {
+        std::vector<uint8_t> bytes(journal.size());
+        bytes.resize(journal.copy(bytes.data(), bytes.size()));
+        FILE* f = fopen(journalPath, "wb");
+        if (!f || fwrite(bytes.data(), 1, bytes.size(), f) != bytes.size()) {
+            fprintf(stderr, "%s: cannot write journal\n", journalPath);
+            return 1;
+        }
+        fclose(f);
+        printf("journal: %zu bytes, %lu passes recorded\n", bytes.size(), (unsigned long)journal.passCount());
+    }
+    return boats.strikes() == 0 && boats.passed() == (uint32_t)count && plant.stallUs() == 0
+        && last == lowered ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+// Virtual-time check of the round-robin sonic scheduler (MidSem/Project/SonicScheduler.h)
+// against the HC-SR04 echo model in BoatEcho.h, for targets the sensor hears
+// for longer than a slot: a wall past the 4m accept range, and open water,
+// where every ping ends in the ~38ms no-echo pulse.
+//
+// A model samples every sensor's EchoCapture every 50us. More than one busy
+// at once is two pings in the air together, i.e. crosstalk. Each case must
+// also close exactly one slot per ping (no ping refused for still being
+// busy) and read its target as the filter should: the median distance, or
+// the max range for anything beyond it.
+//
+// Build & run (Linux):
+//   g++ -O2 -std=c++17 -Ihal -I../MidSem/Project sonic_schedule.cpp hal/Arduino.cpp ../MidSem/Project/SonicSensor.cpp ../MidSem/Project/EchoCapture.cpp -o sonic_schedule
+//   ./sonic_schedule [seconds]
+
+#include <cstdio>
+#include <cstdlib>
+#include "Arduino.h"
+#include "BoatEcho.h"
+#include "SonicSensor.h"
+#include "SonicScheduler.h"
+
+#define SAMPLE_US       50
+#define TOLERANCE_MM    20      // echo timing rounds to the microsecond
+
+static bool neverOpen() { return false; }
+
+template <uint8_t N>
+struct Case {
+    Sonic* sensors[N];
+    uint32_t overlaps = 0;
+
+    static void sample(uint64_t, void* self) {
+        Case* c = (Case*)self;
+        uint8_t busy = 0;
+        for (uint8_t i = 0; i < N; i++) busy += c->sensors[i]->busy();
+        if (busy > 1) c->overlaps++;
+    }
+};
+
+static uint8_t nextPin = 2;
+
+// walls[i]: what sensor i hears, in mm (0 = no echo)
+template <uint8_t N>
+static bool run(const char* name, const float (&walls)[N], uint32_t seconds) {
+    // Each case gets its own pins; the HAL keeps models for good, so these do too
+    BoatEcho& world = *new BoatEcho(0, 300, neverOpen);
+    Case<N>& c = *new Case<N>();
+    for (uint8_t i = 0; i < N; i++) {
+        uint8_t trig = nextPin++, echo = nextPin++;
+        c.sensors[i] = new Sonic(trig, echo);
+        world.addSonar(SonarSpec{ trig, echo, 0, true, 0, walls[i] });
+    }
+    world.attach();
+    hal_addModel(SAMPLE_US, Case<N>::sample, &c);
+
+    SonicScheduler<Sonic, N> scheduler(c.sensors, Sonic_SlotUs(Sonic_MaxRange, Sonic_GuardUs));
+    scheduler.init(Sonic_MinRange, Sonic_MaxRange, Sonic_Tolerance);
+    uint32_t pings0 = world.pings();
+    uint32_t slots = 0;
+    uint64_t start = hal_nowUs(), end = start + seconds * 1000000ULL;
+    while (hal_nowUs() < end) {
+        if (scheduler.service(micros()) >= 0) slots++;
+        uint32_t waitUs = scheduler.usUntilNextSlot(micros());
+        hal_advanceTo(hal_nowUs() + (waitUs ? waitUs : 100));
+    }
+    uint32_t pings = world.pings() - pings0;
+
+    bool ok = c.overlaps == 0 && pings >= slots && pings - slots <= 1;
+    printf("%-12s %6u pings %6u slots  slot %5.1f ms  overlaps %5u ",
+           name, pings, slots, slots ? (hal_nowUs() - start) / 1e3 / slots : 0.0, c.overlaps);
+    for (uint8_t i = 0; i < N; i++) {
+        float expect = walls[i] == 0 || walls[i] > Sonic_MaxRange.mm() ? Sonic_MaxRange.mm() : walls[i];
+        float got = scheduler.median(i).mm();
+        bool good = got >= expect - TOLERANCE_MM && got <= expect + TOLERANCE_MM
+                 && scheduler.confidence(i) >= Sonic_MinConfidence;
+        printf(" [%u] %4.0f mm %3u%%%s", i, got, scheduler.confidence(i), good ? "" : " (wrong)");
+        ok = ok && good;
+    }
+    printf("  %s\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    uint32_t seconds = argc > 1 ? atoi(argv[1]) : 5;
+    hal_serialMute(true);
+
+    static const float near[] = { 1000, 1500 };
+    static const float beyond[] = { 5500, 6000 };           // past the 4m accept range
+    static const float openWater[] = { 0, 0 };              // no echo: the full 38ms pulse
+    static const float mixed[] = { 0, 1200, 5800 };
+    static const float alone[] = { 0 };
+
+    bool ok = true;
+    ok &= run("near", near, seconds);
+    ok &= run("beyond 4m", beyond, seconds);
+    ok &= run("open water", openWater, seconds);
+    ok &= run("mixed", mixed, seconds);
+    ok &= run("one sensor", alone, seconds);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -6,11 +6,11 @@
 #include "PrepLow.h"
 #include "EmergencyRaise.h"
 #include "EmergencyLower.h"
+#include "Fsm.h"
 
 // --------- State enum ----------
-enum State { DOWN, PREP_RAISE, RAISING, UP, PREP_LOW, LOWERING, EMERG_RAISE, EMERG_LOWER };
-State state = DOWN;
-bool  first = true;
+enum State : uint8_t { DOWN, PREP_RAISE, RAISING, UP, PREP_LOW, LOWERING, EMERG_RAISE, EMERG_LOWER };
+struct Inputs {};   // nothing yet: the modules read their own inputs
 
 // --------- One-shot requests set by readInputs() ----------
 bool reqRaise=false, reqLower=false, reqAbort=false;
@@ -54,64 +54,77 @@ void setup() {
   ledcAttachPin(PIN_MOTOR_PWM, PWM_MOTOR_CH);
 #endif
 
-  // set safe posture
+  // set safe posture (DOWN is entered on the first loop)
   roadGreen(); marineRed(); gatesUp(); motorStop();
+}
+
+// --------- State table ----------
+// Each row adapts one state module to the engine: enter on entry, tick every
+// loop. The engine (Fsm.h) runs the next state's enter, so the modules no
+// longer need their s_inited guards.
+static void  downEnter(Inputs&)              { Down_enter(); }
+static State downTick(Inputs&, uint32_t)     { return Down_tick(reqRaise, boatWaiting()) == DownResult::TO_PREP_RAISE ? PREP_RAISE : DOWN; }
+
+static void  prepRaiseEnter(Inputs&)         { PrepRaise_enter(); }
+static State prepRaiseTick(Inputs&, uint32_t) {
+  PrepRaiseResult r = PrepRaise_tick(carOnBridge(), millis());
+  if (r == PrepRaiseResult::TO_EMERG_LOWER) return EMERG_LOWER;
+  if (r == PrepRaiseResult::TO_RAISING)     return RAISING;
+  return PREP_RAISE;
+}
+
+static void  raisingEnter(Inputs&)           { Up_enterRaising(); }
+static State raisingTick(Inputs&, uint32_t) {
+  RaisingResult r = Up_tickRaising(reqAbort, carOnBridge(), topLimit(), millis());
+  if (r == RaisingResult::TO_UP)              return UP;
+  if (r == RaisingResult::TO_EMERGENCY_LOWER) return EMERG_LOWER;
+  return RAISING;
+}
+
+static void  upEnter(Inputs&)                { Up_enter(); }
+static State upTick(Inputs&, uint32_t)       { return Up_tick(reqLower, boatDetected()) == UpResult::TO_PREP_LOW ? PREP_LOW : UP; }
 
-  // enter DOWN
-  Down_enter();
+static void  prepLowEnter(Inputs&)           { PrepLow_enter(); }
+static State prepLowTick(Inputs&, uint32_t) {
+  PrepLowResult r = PrepLow_tick(boatUnderSpan());
+  if (r == PrepLowResult::TO_UP)       return UP;
+  if (r == PrepLowResult::TO_LOWERING) return LOWERING;
+  return PREP_LOW;
 }
 
+static void  loweringEnter(Inputs&)          { Down_enterLowering(); }
+static State loweringTick(Inputs&, uint32_t) {
+  LoweringResult r = Down_tickLowering(reqAbort, boatUnderSpan(), bottomLimit(), millis());
+  if (r == LoweringResult::TO_DOWN)            return DOWN;
+  if (r == LoweringResult::TO_EMERGENCY_RAISE) return EMERG_RAISE;
+  return LOWERING;
+}
+
+static void  emergRaiseEnter(Inputs&)        { EmergencyRaise_enter(); }
+static State emergRaiseTick(Inputs&, uint32_t) { return EmergencyRaise_tick(topLimit()) == EmergRaiseResult::TO_UP ? UP : EMERG_RAISE; }
+
+static void  emergLowerEnter(Inputs&)        { EmergencyLower_enter(); }
+static State emergLowerTick(Inputs&, uint32_t) { return EmergencyLower_tick(bottomLimit()) == EmergLowerResult::TO_DOWN ? DOWN : EMERG_LOWER; }
+
+static constexpr FsmRow<State, Inputs> States[] = {
+  { DOWN,        downEnter,       downTick,       nullptr },
+  { PREP_RAISE,  prepRaiseEnter,  prepRaiseTick,  nullptr },
+  { RAISING,     raisingEnter,    raisingTick,    nullptr },
+  { UP,          upEnter,         upTick,         nullptr },
+  { PREP_LOW,    prepLowEnter,    prepLowTick,    nullptr },
+  { LOWERING,    loweringEnter,   loweringTick,   nullptr },
+  { EMERG_RAISE, emergRaiseEnter, emergRaiseTick, nullptr },
+  { EMERG_LOWER, emergLowerEnter, emergLowerTick, nullptr },
+};
+static Fsm<State, Inputs, 8, States> bridge(DOWN);
+
 void loop() {
   // read buttons/sensors and set requests
   readInputs();
 
-  switch (state) {
-
-    case DOWN: {
-      DownResult r = Down_tick(reqRaise, boatWaiting());
-      if      (r == DownResult::TO_PREP_RAISE) { state = PREP_RAISE; PrepRaise_enter(); }
-      else if (r == DownResult::STAY) { /* do nothing */ }
-    } break;
-
-    case PREP_RAISE: {
-      PrepRaiseResult r = PrepRaise_tick(carOnBridge(), millis());
-      if      (r == PrepRaiseResult::TO_EMERG_LOWER) { state = EMERG_LOWER; EmergencyLower_enter(); }
-      else if (r == PrepRaiseResult::TO_RAISING)     { state = RAISING;     Up_enterRaising(); }
-    } break;
-
-    case RAISING: {
-      RaisingResult r = Up_tickRaising(reqAbort, carOnBridge(), topLimit(), millis());
-      if      (r == RaisingResult::TO_UP)              { state = UP;          Up_enter(); }
-      else if (r == RaisingResult::TO_EMERGENCY_LOWER) { state = EMERG_LOWER; EmergencyLower_enter(); }
-    } break;
-
-    case UP: {
-      UpResult r = Up_tick(reqLower, boatDetected());
-      if      (r == UpResult::TO_PREP_LOW)  { state = PREP_LOW; PrepLow_enter(); }
-    } break;
-
-    case PREP_LOW: {
-      PrepLowResult r = PrepLow_tick(boatUnderSpan());
-      if      (r == PrepLowResult::TO_UP)       { state = UP;       Up_enter(); }
-      else if (r == PrepLowResult::TO_LOWERING) { state = LOWERING; Down_enterLowering(); }
-    } break;
-
-    case LOWERING: {
-      LoweringResult r = Down_tickLowering(reqAbort, boatUnderSpan(), bottomLimit(), millis());
-      if      (r == LoweringResult::TO_DOWN)            { state = DOWN; Down_enter(); }
-      else if (r == LoweringResult::TO_EMERGENCY_RAISE) { state = EMERG_RAISE; EmergencyRaise_enter(); }
-    } break;
-
-    case EMERG_RAISE: {
-      EmergRaiseResult r = EmergencyRaise_tick(topLimit());
-      if (r == EmergRaiseResult::TO_UP) { state = UP; Up_enter(); }
-    } break;
-
-    case EMERG_LOWER: {
-      EmergLowerResult r = EmergencyLower_tick(bottomLimit());
-      if (r == EmergLowerResult::TO_DOWN) { state = DOWN; Down_enter(); }
-    } break;
-  }
+  // first call enters DOWN; after that one table lookup per loop
+  static Inputs in;
+  bridge.tick(in, millis());
 }
 
 /* ----------------- INPUTS + LIGHTS + GATES (STUBS) ----------------- */
@@ -0,0 +1,79 @@
+#ifndef FSM_H
+#define FSM_H
+
+#include <stdint.h>
+
+// Table-driven state machine engine, header only.
+//
+// Each state has one row of plain function pointers in a constexpr table:
+//   enter(ctx)               - once, on the tick the state is entered
+//   tick(ctx, inStateMs)     - every tick; returns the state to be in next
+//   exit(ctx)                - once, when tick() hands over to another state
+// enter/exit may be nullptr. Rows must be listed in enum order with no gaps
+// (the first row may start at any value), which is checked at compile time,
+// so dispatch is a single array index - no switch, no virtual calls.
+//
+// The engine owns the entry timestamp: inStateMs is always measured from the
+// tick the state was entered on, and enter() runs exactly once per entry no
+// matter how the ticks land on the clock.
+
+template <typename S, typename Ctx>
+struct FsmRow {
+    S state;
+    void (*enter)(Ctx&);
+    S    (*tick)(Ctx&, uint32_t inStateMs);
+    void (*exit)(Ctx&);
+};
+
+template <typename S, typename Ctx, uint8_t N>
+constexpr bool fsmTableValid(const FsmRow<S, Ctx> (&table)[N], uint8_t i = 0) {
+    return i == N || ((uint8_t)table[i].state == (uint8_t)table[0].state + i
+                      && table[i].tick != nullptr
+                      && fsmTableValid(table, i + 1));
+}
+
+template <typename S, typename Ctx, uint8_t N, const FsmRow<S, Ctx> (&Table)[N]>
+class Fsm {
+    static_assert(fsmTableValid(Table), "FSM table rows must be in enum order, contiguous, each with a tick handler");
+    private:
+        S current;
+        S previous;
+        uint32_t enteredAt;
+        bool started;
+
+        static const FsmRow<S, Ctx>& row(S s) { return Table[(uint8_t)s - (uint8_t)Table[0].state]; }
+        static bool inTable(S s) { return (uint8_t)s - (uint8_t)Table[0].state < N; }
+
+        void enterState(Ctx& ctx, uint32_t nowMs) {
+            enteredAt = nowMs;
+            started = true;
+            if (row(current).enter) row(current).enter(ctx);
+        }
+    public:
+        explicit Fsm(S initial) : current(initial), previous(initial), enteredAt(0), started(false) {}
+
+        // Run the current state once. The first call enters the initial state.
+        S tick(Ctx& ctx, uint32_t nowMs) {
+            if (!started) enterState(ctx, nowMs);
+            S next = row(current).tick(ctx, nowMs - enteredAt);
+            if (next != current) go(ctx, next, nowMs);
+            return current;
+        }
+
+        // Transition from outside tick() (manual override, reset). Runs the
+        // same exit/enter pair a returned state would. Unknown states are ignored.
+        void go(Ctx& ctx, S next, uint32_t nowMs) {
+            if (!inTable(next)) return;
+            if (started && row(current).exit) row(current).exit(ctx);
+            previous = current;
+            current = next;
+            enterState(ctx, nowMs);
+        }
+
+        bool running() const { return started; }
+        S state() const { return current; }
+        S last() const { return previous; }
+        uint32_t inStateMs(uint32_t nowMs) const { return nowMs - enteredAt; }
+};
+
+#endif